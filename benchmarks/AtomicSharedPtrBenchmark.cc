@@ -0,0 +1,108 @@
+// Readers taking snapshots of a shared configuration while one writer keeps publishing new ones:
+// mutex-protected SharedPtr vs AtomicSharedPtr
+// Usage: AtomicSharedPtrBenchmark [max_readers]   (default: 64)
+
+#include "../src/SmartPtrs/AtomicSharedPtr.hpp"
+#include "../src/SmartPtrs/SharedPtr.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using ds::smart_ptrs::SharedPtr;
+
+constexpr auto DURATION = std::chrono::milliseconds(300);
+constexpr auto PUBLISH_EVERY = std::chrono::microseconds(100);
+
+struct Config {
+    long version;
+    long values[7];
+};
+
+SharedPtr<Config> make_config(long version) {
+    return ds::smart_ptrs::make_shared<Config>(Config{version, {}});
+}
+
+class LockedSlot {
+  private:
+    mutable std::mutex mutex_;
+    SharedPtr<Config> config_ = make_config(0);
+
+  public:
+    SharedPtr<Config> load() const {
+        std::lock_guard guard(mutex_);
+        return config_;
+    }
+
+    void store(SharedPtr<Config> config) {
+        std::lock_guard guard(mutex_);
+        config_ = std::move(config);
+    }
+};
+
+class AtomicSlot {
+  private:
+    ds::smart_ptrs::AtomicSharedPtr<Config> config_{make_config(0)};
+
+  public:
+    SharedPtr<Config> load() const {
+        return config_.load();
+    }
+
+    void store(SharedPtr<Config> config) {
+        config_.store(std::move(config));
+    }
+};
+
+// Millions of snapshots per second taken by all readers together
+template <typename Slot>
+double run(size_t readers) {
+    Slot slot;
+    std::atomic<bool> done{false};
+    std::atomic<long> loads{0};
+
+    std::vector<std::thread> threads;
+    for (size_t r = 0; r < readers; ++r) {
+        threads.emplace_back([&] {
+            long local = 0;
+            long sink = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                sink += slot.load()->version;
+                ++local;
+            }
+            loads.fetch_add(local + (sink < 0 ? 1 : 0), std::memory_order_relaxed);
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (long version = 1; std::chrono::steady_clock::now() - start < DURATION; ++version) {
+        slot.store(make_config(version));
+        std::this_thread::sleep_for(PUBLISH_EVERY);
+    }
+    done = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(loads.load()) / seconds / 1e6;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t max_readers = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 64;
+    max_readers = max_readers == 0 ? 1 : max_readers;
+
+    std::printf("readers   mutex+SharedPtr   AtomicSharedPtr   (Mloads/s)\n");
+    for (size_t readers = 1; readers <= max_readers; readers *= 2) {
+        const double locked = run<LockedSlot>(readers);
+        const double atomic = run<AtomicSlot>(readers);
+        std::printf("%7zu   %15.2f   %15.2f\n", readers, locked, atomic);
+    }
+    return 0;
+}
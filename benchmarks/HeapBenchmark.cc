@@ -0,0 +1,64 @@
+// Push n random keys into a heap and pop them all, for several arities
+// Usage: HeapBenchmark [n ...]   (default: 1M and 10M elements; 100M needs ~1.6 GB)
+
+#include "../src/Containers/BinaryHeap.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ns(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+template <size_t Arity>
+void run(const std::vector<uint64_t>& keys) {
+    ds::containers::BinaryHeap<uint64_t, Arity> heap;
+
+    auto start = Clock::now();
+    for (uint64_t key : keys) {
+        heap.insert(key);
+    }
+    const double push_ns = elapsed_ns(start) / static_cast<double>(keys.size());
+
+    uint64_t checksum = 0;
+    start = Clock::now();
+    while (!heap.empty()) {
+        checksum = checksum * 31 + heap.extract_min();
+    }
+    const double pop_ns = elapsed_ns(start) / static_cast<double>(keys.size());
+
+    std::printf("  arity %zu: push %7.1f ns/op   pop %7.1f ns/op   (checksum %llx)\n", Arity, push_ns, pop_ns,
+                static_cast<unsigned long long>(checksum));
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+    if (sizes.empty()) {
+        sizes = {1'000'000, 10'000'000};
+    }
+
+    for (size_t n : sizes) {
+        std::vector<uint64_t> keys(n);
+        std::mt19937_64 gen(42);
+        for (auto& key : keys) {
+            key = gen();
+        }
+
+        std::printf("n = %zu\n", n);
+        run<2>(keys);
+        run<4>(keys);
+        run<8>(keys);
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+// Merging k sorted runs: concatenate + re-heapify (PriorityQueue::merge style), LoserTree,
+// and parallel_merge over a ThreadPool
+// Usage: MergeBenchmark [threads]   (default: hardware concurrency)
+
+#include "../src/Concurrency/ParallelMerge/ParallelMerge.hpp"
+#include "../src/Containers/BinaryHeap.hpp"
+#include "../src/Containers/LoserTree.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <utility>
+
+namespace {
+
+constexpr size_t TOTAL = 16'000'000;
+
+using Runs = ds::containers::DynamicArray<ds::containers::DynamicArray<uint64_t>>;
+
+Runs make_runs(size_t k) {
+    std::mt19937_64 gen(k);
+    Runs runs;
+    for (size_t r = 0; r < k; ++r) {
+        ds::containers::DynamicArray<uint64_t> run(TOTAL / k);
+        uint64_t value = 0;
+        for (size_t i = 0; i < run.size(); ++i) {
+            value += gen() % 1024;
+            run[i] = value;
+        }
+        runs.push_back(std::move(run));
+    }
+    return runs;
+}
+
+template <typename F>
+double seconds(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Concatenation followed by heapify and n extractions, what PriorityQueue::merge leads to
+uint64_t heap_merge(const Runs& runs) {
+    ds::containers::DynamicArray<uint64_t> all;
+    for (size_t r = 0; r < runs.size(); ++r) {
+        for (size_t i = 0; i < runs[r].size(); ++i) {
+            all.push_back(runs[r][i]);
+        }
+    }
+    ds::containers::BinaryHeap<uint64_t> heap(std::move(all));
+    uint64_t checksum = 0;
+    while (!heap.empty()) {
+        checksum += heap.extract_min();
+    }
+    return checksum;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t threads = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::thread::hardware_concurrency();
+    threads = threads == 0 ? 1 : threads;
+
+    ds::runtime::ThreadPool pool(threads);
+    pool.start();
+
+    std::printf("%zu elements, %zu threads, time in ms\n", TOTAL, threads);
+    std::printf("runs   heapify+extract   LoserTree   parallel_merge\n");
+    for (size_t k : {4, 16, 64, 256}) {
+        const Runs runs = make_runs(k);
+
+        uint64_t sink = 0;
+        const double heap_ms = 1e3 * seconds([&] { sink += heap_merge(runs); });
+        const double tree_ms = 1e3 * seconds([&] { sink += ds::containers::merge_runs(runs)[TOTAL / 2]; });
+        const double parallel_ms = 1e3 * seconds([&] { sink += ds::runtime::parallel_merge(pool, runs, 4 * threads)[TOTAL / 2]; });
+
+        std::printf("%4zu   %15.1f   %9.1f   %14.1f   (%llu)\n", k, heap_ms, tree_ms, parallel_ms, static_cast<unsigned long long>(sink % 10));
+    }
+
+    pool.stop();
+    return 0;
+}
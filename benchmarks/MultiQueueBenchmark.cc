@@ -0,0 +1,96 @@
+// Throughput of a mutex-protected PriorityQueue vs MultiQueue under a mixed push/pop load
+// Usage: MultiQueueBenchmark [max_threads]   (default: hardware concurrency)
+
+#include "../src/Concurrency/MultiQueue/MultiQueue.hpp"
+#include "../src/Containers/PriorityQueue.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t OPS_PER_THREAD = 1'000'000;
+constexpr size_t PREFILL = 1'000'000;
+
+class LockedQueue {
+  private:
+    std::mutex mutex_;
+    ds::containers::PriorityQueue<size_t> queue_;
+
+  public:
+    void push(long priority, size_t item) {
+        std::lock_guard guard(mutex_);
+        queue_.push(priority, item);
+    }
+
+    bool try_pop() {
+        std::lock_guard guard(mutex_);
+        if (queue_.empty()) {
+            return false;
+        }
+        queue_.pop();
+        return true;
+    }
+};
+
+class RelaxedQueue {
+  private:
+    ds::runtime::MultiQueue<size_t> queue_;
+
+  public:
+    explicit RelaxedQueue(size_t threads) : queue_(threads) {}
+
+    void push(long priority, size_t item) {
+        queue_.push(priority, item);
+    }
+
+    bool try_pop() {
+        return queue_.try_pop().has_value();
+    }
+};
+
+// Every thread alternates push and pop, like workers that spawn as many tasks as they run
+template <typename Queue>
+double run(Queue& queue, size_t threads) {
+    std::mt19937_64 gen(1);
+    for (size_t i = 0; i < PREFILL; ++i) {
+        queue.push(static_cast<long>(gen() >> 1), i);
+    }
+
+    std::vector<std::thread> workers;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&queue, t] {
+            std::mt19937_64 local(t + 2);
+            for (size_t i = 0; i < OPS_PER_THREAD / 2; ++i) {
+                queue.push(static_cast<long>(local() >> 1), i);
+                queue.try_pop();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(threads * OPS_PER_THREAD) / seconds / 1e6;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t max_threads = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::thread::hardware_concurrency();
+    max_threads = max_threads == 0 ? 1 : max_threads;
+
+    std::printf("threads   mutex+PriorityQueue   MultiQueue   (Mops/s)\n");
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        LockedQueue locked;
+        RelaxedQueue relaxed(threads);
+        const double locked_mops = run(locked, threads);
+        const double relaxed_mops = run(relaxed, threads);
+        std::printf("%7zu   %19.2f   %10.2f\n", threads, locked_mops, relaxed_mops);
+    }
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "Fiber.hpp"
 #include "Coro.hpp"
+#include <utility>
 
 namespace ds::runtime {
 
@@ -24,14 +25,23 @@ void Fiber::step() {
     current_ = prev_fiber;
 
     /* polling the completion */
-    if (!get_coro().is_done()) {
+    if (get_coro().is_done()) {
+        delete this;
+    } else if (on_park_) {
+        /* parked: whoever gets woken by on_park_ reschedules us */
+        Task on_park = std::exchange(on_park_, nullptr);
+        on_park();
+    } else {
         /* re-subscription (or rescheduling) */
         this->schedule();
-    } else {
-        delete this;
     }
 }
 
+void Fiber::park(Task on_park) {
+    on_park_ = std::move(on_park);
+    coro_.suspend();
+}
+
 /* get current fiber */
 Fiber* Fiber::current() {
     return current_;
@@ -16,6 +16,9 @@ class Fiber : public vvv::IntrusiveListNode<Fiber> {
     ds::runtime::Coroutine coro_;
     Scheduler& sched_;
 
+    /* runs right after the next suspension instead of rescheduling (see park()) */
+    Task on_park_;
+
     static thread_local Fiber* current_;
 
   public:
@@ -25,6 +28,11 @@ class Fiber : public vvv::IntrusiveListNode<Fiber> {
 
     void step();
 
+    /* Suspends the current fiber without rescheduling it.
+     * on_park runs once the fiber is off its stack and is responsible
+     * for calling schedule() later (from a timer, a wait queue ...) */
+    void park(Task on_park);
+
     static void set_current(Fiber*);
 
     static Fiber* current();
@@ -0,0 +1,17 @@
+#include "Sleep.hpp"
+
+namespace ds::fiber {
+
+void sleep_for(std::chrono::steady_clock::duration delay) {
+    auto self = runtime::Fiber::current();
+
+    // the timer is armed only after the fiber is off its stack,
+    // so it can't be resumed on another worker before the suspension completes
+    self->park([self, delay] {
+        self->current_scheduler().submit_after(delay, [self] {
+            self->schedule();
+        });
+    });
+}
+
+};  // namespace ds::fiber
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Fiber.hpp"
+#include <chrono>
+
+namespace ds::fiber {
+
+// Parks the current fiber for at least `delay` without blocking its worker thread
+// The wake-up goes through the scheduler's timing wheel (ThreadPool::submit_after)
+//
+// If the scheduler is stopped meanwhile, the fiber is resumed early so it can run to completion
+void sleep_for(std::chrono::steady_clock::duration delay);
+
+};  // namespace ds::fiber
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../Spinlock/Preamble.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace ds::runtime {
+
+// Lock-free Treiber stack with an elimination-backoff array
+//
+// ABA: the head (and every elimination slot) is a 64-bit word holding a 48-bit node pointer
+// and a 16-bit version tag that changes on every successful CAS. This makes ABA improbable, not
+// impossible: the tag wraps after 65536 successful CASes, so a thread that stalls between reading
+// the head and its CAS while exactly a multiple of 2^16 others succeed, ending on the same node,
+// is fooled
+//
+// Reclamation: popped nodes aren't freed but recycled through an internal lock-free free list
+// and released only in the destructor. A thread holding a stale head may still read node->next,
+// but that memory is always a live Node, and short of a tag wrap the tagged CAS rejects whatever it read
+//
+// Elimination: when a CAS on the head fails because of contention, a push may hand its node
+// directly to a concurrent pop through a random slot of a small array, and neither touches the head
+template <typename T>
+class LockFreeStack {
+  private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    static constexpr uint32_t ELIMINATION_SPINS = 64;
+    static constexpr uint32_t MAX_BACKOFF = 256;
+
+    static_assert(sizeof(void*) == 8, "tagged pointers need a 64-bit address space");
+
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* item() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    // [16-bit tag | 48-bit pointer]
+    static constexpr int TAG_SHIFT = 48;
+    static constexpr uint64_t PTR_MASK = (uint64_t{1} << TAG_SHIFT) - 1;
+
+    static uint64_t pack(Node* node, uint64_t tag) noexcept {
+        return (tag << TAG_SHIFT) | (reinterpret_cast<uintptr_t>(node) & PTR_MASK);
+    }
+
+    static Node* ptr_of(uint64_t word) noexcept {
+        return reinterpret_cast<Node*>(word & PTR_MASK);
+    }
+
+    static uint64_t next_tag(uint64_t word) noexcept {
+        return (word >> TAG_SHIFT) + 1;
+    }
+
+    struct alignas(CACHE_LINE_SIZE) EliminationSlot {
+        std::atomic<uint64_t> offer{0};
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> free_head_{0};
+
+    const size_t elimination_size_;
+    std::unique_ptr<EliminationSlot[]> elimination_;
+
+    // Treiber push/pop of a single node (or a ready chain first..last) on a tagged head
+    static void push_chain(std::atomic<uint64_t>& head, Node* first, Node* last) noexcept;
+
+    static Node* pop_node(std::atomic<uint64_t>& head) noexcept;
+
+    bool try_push_once(Node* node) noexcept;
+
+    Node* try_pop_once(bool& empty) noexcept;
+
+    bool try_eliminate_push(Node* node) noexcept;
+
+    Node* try_eliminate_pop() noexcept;
+
+    EliminationSlot* random_slot() noexcept;
+
+    Node* allocate_node();
+
+    void recycle_node(Node* node) noexcept;
+
+  public:
+    // elimination_slots == 0 picks a size from the number of hardware threads
+    explicit LockFreeStack(size_t elimination_slots = 0);
+
+    ~LockFreeStack();
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack(LockFreeStack&&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(LockFreeStack&&) = delete;
+
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    void push(const T& item);
+
+    void push(T&& item);
+
+    // Returns std::nullopt if the stack is empty
+    std::optional<T> try_pop();
+
+    // Links all items into a private chain and publishes it with a single CAS
+    // The last item of the range ends up on top
+    template <typename InputIt>
+    void push_list(InputIt first, InputIt last);
+
+    // Detaches the whole stack with a single CAS and moves the items to out (top first)
+    // Returns the number of popped items
+    template <typename OutputIt>
+    size_t pop_all(OutputIt out);
+
+    bool empty_approx() const noexcept;
+};
+
+#include "LockFreeStack_inl.hpp"
+};  // namespace ds::runtime
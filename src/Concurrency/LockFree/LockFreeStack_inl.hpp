@@ -0,0 +1,275 @@
+template <typename T>
+LockFreeStack<T>::LockFreeStack(size_t elimination_slots)
+    : elimination_size_(elimination_slots != 0 ? elimination_slots : std::max(1u, std::thread::hardware_concurrency() / 2)),
+      elimination_(new EliminationSlot[elimination_size_]) {}
+
+template <typename T>
+LockFreeStack<T>::~LockFreeStack() {
+    // no concurrent access is possible here
+    Node* node = ptr_of(head_.load(std::memory_order_relaxed));
+    while (node != nullptr) {
+        Node* next = node->next.load(std::memory_order_relaxed);
+        std::destroy_at(node->item());
+        delete node;
+        node = next;
+    }
+
+    node = ptr_of(free_head_.load(std::memory_order_relaxed));
+    while (node != nullptr) {
+        Node* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+    }
+}
+
+template <typename T>
+void LockFreeStack<T>::push_chain(std::atomic<uint64_t>& head, Node* first, Node* last) noexcept {
+    uint64_t old_head = head.load(std::memory_order_relaxed);
+    do {
+        last->next.store(ptr_of(old_head), std::memory_order_relaxed);
+    } while (!head.compare_exchange_weak(old_head, pack(first, next_tag(old_head)), std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <typename T>
+typename LockFreeStack<T>::Node* LockFreeStack<T>::pop_node(std::atomic<uint64_t>& head) noexcept {
+    uint64_t old_head = head.load(std::memory_order_acquire);
+    for (;;) {
+        Node* node = ptr_of(old_head);
+        if (node == nullptr) {
+            return nullptr;
+        }
+
+        // node may already be popped by someone else, but it's never freed => reading next is safe
+        Node* next = node->next.load(std::memory_order_relaxed);
+        if (head.compare_exchange_weak(old_head, pack(next, next_tag(old_head)), std::memory_order_acquire, std::memory_order_acquire)) {
+            return node;
+        }
+    }
+}
+
+template <typename T>
+bool LockFreeStack<T>::try_push_once(Node* node) noexcept {
+    uint64_t old_head = head_.load(std::memory_order_relaxed);
+    node->next.store(ptr_of(old_head), std::memory_order_relaxed);
+    return head_.compare_exchange_strong(old_head, pack(node, next_tag(old_head)), std::memory_order_release, std::memory_order_relaxed);
+}
+
+template <typename T>
+typename LockFreeStack<T>::Node* LockFreeStack<T>::try_pop_once(bool& empty) noexcept {
+    uint64_t old_head = head_.load(std::memory_order_acquire);
+    Node* node = ptr_of(old_head);
+
+    empty = node == nullptr;
+    if (empty) {
+        return nullptr;
+    }
+
+    Node* next = node->next.load(std::memory_order_relaxed);
+    if (head_.compare_exchange_strong(old_head, pack(next, next_tag(old_head)), std::memory_order_acquire, std::memory_order_relaxed)) {
+        return node;
+    }
+    return nullptr;
+}
+
+template <typename T>
+typename LockFreeStack<T>::EliminationSlot* LockFreeStack<T>::random_slot() noexcept {
+    // cheap per-thread xorshift, quality doesn't matter here
+    thread_local uint32_t state = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return &elimination_[state % elimination_size_];
+}
+
+template <typename T>
+bool LockFreeStack<T>::try_eliminate_push(Node* node) noexcept {
+    EliminationSlot* slot = random_slot();
+
+    uint64_t current = slot->offer.load(std::memory_order_relaxed);
+    if (ptr_of(current) != nullptr) {
+        return false;  // someone else is already offering here
+    }
+
+    const uint64_t offer = pack(node, next_tag(current));
+    if (!slot->offer.compare_exchange_strong(current, offer, std::memory_order_release, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    // wait a little for a popper to take the node (it changes the tag when it does)
+    for (uint32_t i = 0; i < ELIMINATION_SPINS; ++i) {
+        if (slot->offer.load(std::memory_order_acquire) != offer) {
+            return true;
+        }
+        CPU_PAUSE();
+    }
+
+    // withdraw the offer. failure means a popper took it in the meantime
+    uint64_t expected = offer;
+    return !slot->offer.compare_exchange_strong(expected, pack(nullptr, next_tag(offer)), std::memory_order_acquire, std::memory_order_acquire);
+}
+
+template <typename T>
+typename LockFreeStack<T>::Node* LockFreeStack<T>::try_eliminate_pop() noexcept {
+    EliminationSlot* slot = random_slot();
+
+    uint64_t current = slot->offer.load(std::memory_order_acquire);
+    Node* node = ptr_of(current);
+    if (node == nullptr) {
+        return nullptr;
+    }
+
+    if (slot->offer.compare_exchange_strong(current, pack(nullptr, next_tag(current)), std::memory_order_acquire, std::memory_order_relaxed)) {
+        return node;
+    }
+    return nullptr;
+}
+
+template <typename T>
+typename LockFreeStack<T>::Node* LockFreeStack<T>::allocate_node() {
+    if (Node* node = pop_node(free_head_)) {
+        return node;
+    }
+    return new Node();
+}
+
+template <typename T>
+void LockFreeStack<T>::recycle_node(Node* node) noexcept {
+    push_chain(free_head_, node, node);
+}
+
+template <typename T>
+template <typename... Args>
+void LockFreeStack<T>::emplace(Args&&... args) {
+    Node* node = allocate_node();
+    try {
+        std::construct_at(node->item(), std::forward<Args>(args)...);
+    } catch (...) {
+        recycle_node(node);
+        throw;
+    }
+
+    uint32_t backoff = 1;
+    for (;;) {
+        if (try_push_once(node)) {
+            return;
+        }
+        // the head is contended => try to meet a pop halfway
+        if (try_eliminate_push(node)) {
+            return;
+        }
+        for (uint32_t i = 0; i < backoff; ++i) {
+            CPU_PAUSE();
+        }
+        backoff = std::min(backoff << 1, MAX_BACKOFF);
+    }
+}
+
+template <typename T>
+void LockFreeStack<T>::push(const T& item) {
+    emplace(item);
+}
+
+template <typename T>
+void LockFreeStack<T>::push(T&& item) {
+    emplace(std::move(item));
+}
+
+template <typename T>
+std::optional<T> LockFreeStack<T>::try_pop() {
+    Node* node = nullptr;
+    uint32_t backoff = 1;
+
+    for (;;) {
+        bool empty = false;
+        node = try_pop_once(empty);
+        if (node != nullptr) {
+            break;
+        }
+        if (empty) {
+            // a push might be waiting in the elimination array
+            node = try_eliminate_pop();
+            if (node != nullptr) {
+                break;
+            }
+            return std::nullopt;
+        }
+
+        node = try_eliminate_pop();
+        if (node != nullptr) {
+            break;
+        }
+        for (uint32_t i = 0; i < backoff; ++i) {
+            CPU_PAUSE();
+        }
+        backoff = std::min(backoff << 1, MAX_BACKOFF);
+    }
+
+    std::optional<T> item(std::move(*node->item()));
+    std::destroy_at(node->item());
+    recycle_node(node);
+    return item;
+}
+
+template <typename T>
+template <typename InputIt>
+void LockFreeStack<T>::push_list(InputIt first, InputIt last) {
+    Node* top = nullptr;
+    Node* bottom = nullptr;
+
+    try {
+        for (; first != last; ++first) {
+            Node* node = allocate_node();
+            try {
+                std::construct_at(node->item(), *first);
+            } catch (...) {
+                recycle_node(node);
+                throw;
+            }
+
+            node->next.store(top, std::memory_order_relaxed);
+            top = node;
+            if (bottom == nullptr) {
+                bottom = node;
+            }
+        }
+    } catch (...) {
+        while (top != nullptr) {
+            Node* next = top->next.load(std::memory_order_relaxed);
+            std::destroy_at(top->item());
+            recycle_node(top);
+            top = next;
+        }
+        throw;
+    }
+
+    if (top != nullptr) {
+        push_chain(head_, top, bottom);
+    }
+}
+
+template <typename T>
+template <typename OutputIt>
+size_t LockFreeStack<T>::pop_all(OutputIt out) {
+    uint64_t old_head = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(old_head, pack(nullptr, next_tag(old_head)), std::memory_order_acquire, std::memory_order_relaxed)) {
+    }
+
+    // the detached chain is private now
+    size_t count = 0;
+    Node* node = ptr_of(old_head);
+    while (node != nullptr) {
+        Node* next = node->next.load(std::memory_order_relaxed);
+        *out = std::move(*node->item());
+        ++out;
+        std::destroy_at(node->item());
+        recycle_node(node);
+        node = next;
+        ++count;
+    }
+    return count;
+}
+
+template <typename T>
+bool LockFreeStack<T>::empty_approx() const noexcept {
+    return ptr_of(head_.load(std::memory_order_acquire)) == nullptr;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "../Spinlock/Preamble.hpp"
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace ds::runtime {
+
+// What push() does when the queue is full
+enum class OverflowPolicy {
+    Block,       // wait until a consumer frees a slot (backpressure)
+    Reject,      // fail immediately, the caller decides what to do with the item
+    DropOldest,  // evict the oldest element to make room for the new one
+};
+
+// Bounded lock-free multi-producer/multi-consumer queue (Dmitry Vyukov's algorithm)
+//
+// Every cell carries a sequence number telling whose turn it is:
+//   sequence == pos         => the cell is free for the producer that claims position pos
+//   sequence == pos + 1     => the cell holds the element for the consumer that claims pos
+// Producers and consumers claim positions with a CAS on their own counter and then
+// touch only their cell, so they never contend on a shared lock
+//
+// Blocking operations spin for a while and then park on a C++20 atomic wait
+//
+// A claimed cell must always be published: an exception between claiming and publishing would
+// stall its position forever. Elements are therefore only moved into and out of cells, and a
+// value whose construction may throw is built before a cell is claimed
+template <typename T>
+class MPMCQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>, "MPMCQueue moves elements in and out of claimed cells");
+
+  private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    static constexpr uint32_t SPIN_LIMIT = 128;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* item() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    const size_t capacity_;
+    const size_t mask_;
+    const OverflowPolicy policy_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_{0};
+
+    // parking: the sequence counters are bumped (and notified) only when somebody sleeps on them
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> not_full_seq_{0};
+    std::atomic<uint32_t> push_waiters_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> not_empty_seq_{0};
+    std::atomic<uint32_t> pop_waiters_{0};
+    std::atomic<bool> is_closed_{false};
+
+    void notify_not_full() noexcept;
+
+    void notify_not_empty() noexcept;
+
+  public:
+    // Capacity is rounded up to the next power of two
+    explicit MPMCQueue(size_t capacity, OverflowPolicy policy = OverflowPolicy::Block);
+
+    ~MPMCQueue();
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue(MPMCQueue&&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(MPMCQueue&&) = delete;
+
+    // Non-blocking, returns false if the queue is full
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_push(const T& item);
+
+    bool try_push(T&& item);
+
+    // Non-blocking, returns std::nullopt if the queue is empty
+    std::optional<T> try_pop();
+
+    // Applies the overflow policy when the queue is full
+    // Returns false if the item was rejected (Reject policy, or the queue was closed while blocked)
+    bool push(T item);
+
+    // Blocks until an element is available
+    // Returns std::nullopt once the queue is closed and drained
+    std::optional<T> pop();
+
+    // Wakes up every blocked producer and consumer
+    // Blocked and future push() calls fail, pop() keeps returning the remaining elements
+    void close();
+
+    bool is_closed() const noexcept;
+
+    size_t size_approx() const noexcept;
+
+    size_t capacity() const noexcept;
+
+    OverflowPolicy policy() const noexcept;
+};
+
+#include "MPMCQueue_inl.hpp"
+};  // namespace ds::runtime
@@ -0,0 +1,233 @@
+template <typename T>
+MPMCQueue<T>::MPMCQueue(size_t capacity, OverflowPolicy policy)
+    : capacity_(std::bit_ceil(capacity < 2 ? size_t{2} : capacity)),
+      mask_(capacity_ - 1),
+      policy_(policy),
+      cells_(new Cell[capacity_]) {
+    for (size_t i = 0; i < capacity_; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+MPMCQueue<T>::~MPMCQueue() {
+    while (try_pop()) {
+    }
+}
+
+template <typename T>
+template <typename... Args>
+bool MPMCQueue<T>::try_emplace(Args&&... args) {
+    if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>) {
+        // may throw, so it happens before a cell is claimed
+        T value(std::forward<Args>(args)...);
+        return try_emplace(std::move(value));
+    }
+
+    Cell* cell;
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        // acquire pairs with the consumer's release, the previous element is fully moved out
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            // the cell is free for this position => try to claim it
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // the cell still holds an element from the previous lap => full
+            return false;
+        } else {
+            // another producer claimed pos already
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::construct_at(cell->item(), std::forward<Args>(args)...);
+
+    // publish the element to the consumer of this position
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    notify_not_empty();
+    return true;
+}
+
+template <typename T>
+bool MPMCQueue<T>::try_push(const T& item) {
+    return try_emplace(item);
+}
+
+template <typename T>
+bool MPMCQueue<T>::try_push(T&& item) {
+    return try_emplace(std::move(item));
+}
+
+template <typename T>
+std::optional<T> MPMCQueue<T>::try_pop() {
+    Cell* cell;
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t seq = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+        if (diff == 0) {
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // nothing published for this position yet => empty
+            return std::nullopt;
+        } else {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::optional<T> item(std::move(*cell->item()));
+    std::destroy_at(cell->item());
+
+    // the cell becomes free for the producer of the next lap
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+
+    notify_not_full();
+    return item;
+}
+
+template <typename T>
+bool MPMCQueue<T>::push(T item) {
+    uint32_t spins = 0;
+
+    for (;;) {
+        if (is_closed_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (try_push(std::move(item))) {
+            return true;
+        }
+
+        switch (policy_) {
+            case OverflowPolicy::Reject:
+                return false;
+
+            case OverflowPolicy::DropOldest:
+                try_pop();
+                continue;
+
+            case OverflowPolicy::Block:
+                break;
+        }
+
+        if (spins < SPIN_LIMIT) {
+            ++spins;
+            CPU_PAUSE();
+            continue;
+        }
+
+        // Park. Register as a waiter first and recheck, so a consumer that frees a slot
+        // after our failed attempt is guaranteed to see us and bump the sequence
+        uint32_t seq = not_full_seq_.load(std::memory_order_seq_cst);
+        push_waiters_.fetch_add(1, std::memory_order_seq_cst);
+
+        if (is_closed_.load(std::memory_order_acquire)) {
+            push_waiters_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (try_push(std::move(item))) {
+            push_waiters_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        not_full_seq_.wait(seq, std::memory_order_seq_cst);
+        push_waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+std::optional<T> MPMCQueue<T>::pop() {
+    uint32_t spins = 0;
+
+    for (;;) {
+        if (auto item = try_pop()) {
+            return item;
+        }
+        if (is_closed_.load(std::memory_order_acquire)) {
+            // an element could have been published right before close()
+            return try_pop();
+        }
+
+        if (spins < SPIN_LIMIT) {
+            ++spins;
+            CPU_PAUSE();
+            continue;
+        }
+
+        uint32_t seq = not_empty_seq_.load(std::memory_order_seq_cst);
+        pop_waiters_.fetch_add(1, std::memory_order_seq_cst);
+
+        auto item = try_pop();
+        if (!item && !is_closed_.load(std::memory_order_acquire)) {
+            not_empty_seq_.wait(seq, std::memory_order_seq_cst);
+        }
+        pop_waiters_.fetch_sub(1, std::memory_order_relaxed);
+
+        if (item) {
+            return item;
+        }
+    }
+}
+
+template <typename T>
+void MPMCQueue<T>::notify_not_full() noexcept {
+    // the fence orders the cell release above before the waiters check (pairs with fetch_add in push)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (push_waiters_.load(std::memory_order_relaxed) != 0) {
+        not_full_seq_.fetch_add(1, std::memory_order_seq_cst);
+        not_full_seq_.notify_all();
+    }
+}
+
+template <typename T>
+void MPMCQueue<T>::notify_not_empty() noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (pop_waiters_.load(std::memory_order_relaxed) != 0) {
+        not_empty_seq_.fetch_add(1, std::memory_order_seq_cst);
+        not_empty_seq_.notify_all();
+    }
+}
+
+template <typename T>
+void MPMCQueue<T>::close() {
+    is_closed_.store(true, std::memory_order_seq_cst);
+
+    not_full_seq_.fetch_add(1, std::memory_order_seq_cst);
+    not_full_seq_.notify_all();
+    not_empty_seq_.fetch_add(1, std::memory_order_seq_cst);
+    not_empty_seq_.notify_all();
+}
+
+template <typename T>
+bool MPMCQueue<T>::is_closed() const noexcept {
+    return is_closed_.load(std::memory_order_acquire);
+}
+
+template <typename T>
+size_t MPMCQueue<T>::size_approx() const noexcept {
+    const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+    const size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+    return tail >= head ? tail - head : 0;
+}
+
+template <typename T>
+size_t MPMCQueue<T>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename T>
+OverflowPolicy MPMCQueue<T>::policy() const noexcept {
+    return policy_;
+}
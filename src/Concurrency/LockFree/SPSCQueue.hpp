@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace ds::runtime {
+
+// Bounded wait-free queue for exactly one producer thread and one consumer thread
+//
+// Positions are free-running counters, the slot is (position & mask_)
+// The producer owns tail_ and the consumer owns head_; each side keeps a private cached copy
+// of the other side's index and rereads the shared atomic only when the cache says full/empty,
+// so in steady state the two threads don't touch each other's cache lines at all
+template <typename T>
+class SPSCQueue {
+  private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    const size_t capacity_;
+    const size_t mask_;
+    T* slots_;
+    std::allocator<T> allocator_;
+
+    // consumer side
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    // producer side
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+
+  public:
+    // Capacity is rounded up to the next power of two
+    explicit SPSCQueue(size_t capacity);
+
+    ~SPSCQueue();
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue(SPSCQueue&&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(SPSCQueue&&) = delete;
+
+    // [producer only]
+    // Returns false if the queue is full
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_push(const T& item);
+
+    bool try_push(T&& item);
+
+    // [producer only]
+    // Moves up to count items from first, publishing all of them with a single store
+    // Returns the number of pushed items
+    template <typename InputIt>
+    size_t push_n(InputIt first, size_t count);
+
+    // [consumer only]
+    // Returns std::nullopt if the queue is empty
+    std::optional<T> try_pop();
+
+    bool try_pop(T& out);
+
+    // [consumer only]
+    // Moves up to max_count items to out, releasing all the slots with a single store
+    // Returns the number of popped items
+    template <typename OutputIt>
+    size_t pop_n(OutputIt out, size_t max_count);
+
+    // Snapshot, exact only when called from the producer or the consumer while the other side is idle
+    size_t size_approx() const noexcept;
+
+    bool empty_approx() const noexcept;
+
+    size_t capacity() const noexcept;
+};
+
+#include "SPSCQueue_inl.hpp"
+};  // namespace ds::runtime
@@ -0,0 +1,151 @@
+template <typename T>
+SPSCQueue<T>::SPSCQueue(size_t capacity)
+    : capacity_(std::bit_ceil(capacity < 2 ? size_t{2} : capacity)),
+      mask_(capacity_ - 1),
+      slots_(allocator_.allocate(capacity_)) {}
+
+template <typename T>
+SPSCQueue<T>::~SPSCQueue() {
+    // no concurrent access is possible here, so relaxed loads are enough
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    for (size_t pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+        std::destroy_at(slots_ + (pos & mask_));
+    }
+    allocator_.deallocate(slots_, capacity_);
+}
+
+template <typename T>
+template <typename... Args>
+bool SPSCQueue<T>::try_emplace(Args&&... args) {
+    // only the producer writes tail_, so its own value can be read relaxed
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+
+    if (tail - cached_head_ == capacity_) {
+        // looks full => refresh the cached head (acquire pairs with the consumer's release,
+        // so the slot the consumer just vacated is really free)
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail - cached_head_ == capacity_) {
+            return false;
+        }
+    }
+
+    std::construct_at(slots_ + (tail & mask_), std::forward<Args>(args)...);
+
+    // publish the element
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool SPSCQueue<T>::try_push(const T& item) {
+    return try_emplace(item);
+}
+
+template <typename T>
+bool SPSCQueue<T>::try_push(T&& item) {
+    return try_emplace(std::move(item));
+}
+
+template <typename T>
+template <typename InputIt>
+size_t SPSCQueue<T>::push_n(InputIt first, size_t count) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+
+    size_t free_slots = capacity_ - (tail - cached_head_);
+    if (free_slots < count) {
+        cached_head_ = head_.load(std::memory_order_acquire);
+        free_slots = capacity_ - (tail - cached_head_);
+    }
+
+    const size_t n = count < free_slots ? count : free_slots;
+    for (size_t i = 0; i < n; ++i, ++first) {
+        std::construct_at(slots_ + ((tail + i) & mask_), std::move(*first));
+    }
+
+    if (n != 0) {
+        tail_.store(tail + n, std::memory_order_release);
+    }
+    return n;
+}
+
+template <typename T>
+std::optional<T> SPSCQueue<T>::try_pop() {
+    const size_t head = head_.load(std::memory_order_relaxed);
+
+    if (head == cached_tail_) {
+        // looks empty => refresh the cached tail (acquire pairs with the producer's release,
+        // so the element's construction is visible)
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) {
+            return std::nullopt;
+        }
+    }
+
+    T* slot = slots_ + (head & mask_);
+    std::optional<T> item(std::move(*slot));
+    std::destroy_at(slot);
+
+    // hand the slot back to the producer
+    head_.store(head + 1, std::memory_order_release);
+    return item;
+}
+
+template <typename T>
+bool SPSCQueue<T>::try_pop(T& out) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+
+    if (head == cached_tail_) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) {
+            return false;
+        }
+    }
+
+    T* slot = slots_ + (head & mask_);
+    out = std::move(*slot);
+    std::destroy_at(slot);
+
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+template <typename OutputIt>
+size_t SPSCQueue<T>::pop_n(OutputIt out, size_t max_count) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+
+    size_t available = cached_tail_ - head;
+    if (available < max_count) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        available = cached_tail_ - head;
+    }
+
+    const size_t n = max_count < available ? max_count : available;
+    for (size_t i = 0; i < n; ++i, ++out) {
+        T* slot = slots_ + ((head + i) & mask_);
+        *out = std::move(*slot);
+        std::destroy_at(slot);
+    }
+
+    if (n != 0) {
+        head_.store(head + n, std::memory_order_release);
+    }
+    return n;
+}
+
+template <typename T>
+size_t SPSCQueue<T>::size_approx() const noexcept {
+    const size_t head = head_.load(std::memory_order_acquire);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    return tail >= head ? tail - head : 0;
+}
+
+template <typename T>
+bool SPSCQueue<T>::empty_approx() const noexcept {
+    return size_approx() == 0;
+}
+
+template <typename T>
+size_t SPSCQueue<T>::capacity() const noexcept {
+    return capacity_;
+}
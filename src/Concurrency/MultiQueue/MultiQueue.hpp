@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../../Containers/DynamicArray.hpp"
+#include "../../Containers/HeapAlgorithms.hpp"
+#include "../../Containers/PriorityQueue.hpp"
+#include "../Spinlock/Spinlock.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace ds::runtime {
+
+// Relaxed concurrent priority queue (MultiQueue, Rihani/Sanders/Dementiev)
+//
+// The elements are spread over c * P sequential heaps, each behind its own spinlock.
+// push locks a random heap, pop peeks at the cached tops of `pop_choices` random heaps
+// and takes the better one. Locks are only ever try-locked: a busy heap is skipped in favour
+// of another random one, so threads almost never wait for each other
+//
+// pop is not exact: it returns an element close to the top (on average within O(c * P) ranks).
+// Knobs:
+//   queues_per_thread (c): more heaps => less contention, lower quality
+//   pop_choices:           more peeks per pop => better quality, more cache traffic
+//
+// Ordering follows PriorityQueue: the priority that compares greater comes out first,
+// use std::greater<long> for a min-queue
+template <typename T, typename Compare = std::less<long>>
+class MultiQueue {
+  private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    static constexpr size_t ARITY = 4;
+
+    using Node = containers::PriorityNode<T>;
+
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        sync::Spinlock lock;
+        containers::DynamicArray<Node, containers::HeapAllocator<Node>> heap;
+
+        // Copies of the heap state for lock-free peeking, written under the lock
+        std::atomic<size_t> size{0};
+        std::atomic<long> top_priority{0};
+
+        void publish() noexcept;
+    };
+
+    const size_t shard_count_;
+    const size_t pop_choices_;
+    std::unique_ptr<Shard[]> shards_;
+    Compare comp_;
+
+    auto before() const;
+
+    size_t random_shard() const noexcept;
+
+    // True if shard a should be popped rather than shard b (by their published tops)
+    bool better(const Shard& a, const Shard& b) const noexcept;
+
+    Node take_top(Shard& shard);
+
+  public:
+    // Creates queues_per_thread * threads heaps
+    explicit MultiQueue(size_t threads = std::thread::hardware_concurrency(), size_t queues_per_thread = 2, size_t pop_choices = 2,
+                        const Compare& compare = Compare());
+
+    MultiQueue(const MultiQueue&) = delete;
+    MultiQueue(MultiQueue&&) = delete;
+    MultiQueue& operator=(const MultiQueue&) = delete;
+    MultiQueue& operator=(MultiQueue&&) = delete;
+
+    void push(long priority, const T& item);
+
+    // Returns an element near the top, or std::nullopt if every heap was seen empty
+    std::optional<Node> try_pop();
+
+    size_t size_approx() const noexcept;
+
+    bool empty_approx() const noexcept;
+
+    size_t shard_count() const noexcept;
+};
+
+#include "MultiQueue_inl.hpp"
+};  // namespace ds::runtime
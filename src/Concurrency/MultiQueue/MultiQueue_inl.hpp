@@ -0,0 +1,133 @@
+template <typename T, typename Compare>
+void MultiQueue<T, Compare>::Shard::publish() noexcept {
+    if (!heap.empty()) {
+        top_priority.store(heap[0].priority, std::memory_order_relaxed);
+    }
+    size.store(heap.size(), std::memory_order_relaxed);
+}
+
+template <typename T, typename Compare>
+MultiQueue<T, Compare>::MultiQueue(size_t threads, size_t queues_per_thread, size_t pop_choices, const Compare& compare)
+    : shard_count_(std::max<size_t>(threads, 1) * std::max<size_t>(queues_per_thread, 1)),
+      pop_choices_(std::max<size_t>(pop_choices, 1)),
+      shards_(new Shard[shard_count_]),
+      comp_(compare) {}
+
+template <typename T, typename Compare>
+auto MultiQueue<T, Compare>::before() const {
+    return [this](const Node& a, const Node& b) { return comp_(b.priority, a.priority); };
+}
+
+template <typename T, typename Compare>
+size_t MultiQueue<T, Compare>::random_shard() const noexcept {
+    // xorshift64*, one generator per thread, seeded from its address
+    thread_local uint64_t state = reinterpret_cast<uintptr_t>(&state) * 0x9E3779B97F4A7C15ull | 1;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    const uint64_t random = state * 0x2545F4914F6CDD1Dull;
+
+    // multiply-shift instead of a modulo (shard counts stay far below 2^32)
+    return static_cast<size_t>(((random >> 32) * shard_count_) >> 32);
+}
+
+template <typename T, typename Compare>
+bool MultiQueue<T, Compare>::better(const Shard& a, const Shard& b) const noexcept {
+    if (a.size.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    if (b.size.load(std::memory_order_relaxed) == 0) {
+        return true;
+    }
+    return comp_(b.top_priority.load(std::memory_order_relaxed), a.top_priority.load(std::memory_order_relaxed));
+}
+
+template <typename T, typename Compare>
+typename MultiQueue<T, Compare>::Node MultiQueue<T, Compare>::take_top(Shard& shard) {
+    Node result = std::move(shard.heap[0]);
+    if (shard.heap.size() > 1) {
+        shard.heap[0] = std::move(shard.heap.back());
+    }
+    shard.heap.pop_back();
+    if (!shard.heap.empty()) {
+        containers::heap_sift_down<ARITY>(shard.heap.begin(), shard.heap.size(), 0, before());
+    }
+    shard.publish();
+    return result;
+}
+
+template <typename T, typename Compare>
+void MultiQueue<T, Compare>::push(long priority, const T& item) {
+    for (;;) {
+        Shard& shard = shards_[random_shard()];
+        if (!shard.lock.try_lock()) {
+            continue;
+        }
+
+        shard.heap.push_back(Node(priority, item));
+        containers::heap_sift_up<ARITY>(shard.heap.begin(), shard.heap.size() - 1, before());
+        shard.publish();
+        shard.lock.unlock();
+        return;
+    }
+}
+
+template <typename T, typename Compare>
+std::optional<typename MultiQueue<T, Compare>::Node> MultiQueue<T, Compare>::try_pop() {
+    // a few rounds of random choices, enough to find work when there is plenty of it
+    for (size_t attempt = 0; attempt < 2 * shard_count_; ++attempt) {
+        Shard* best = &shards_[random_shard()];
+        for (size_t i = 1; i < pop_choices_; ++i) {
+            Shard* candidate = &shards_[random_shard()];
+            if (better(*candidate, *best)) {
+                best = candidate;
+            }
+        }
+
+        if (best->size.load(std::memory_order_relaxed) == 0 || !best->lock.try_lock()) {
+            continue;
+        }
+        if (best->heap.empty()) {
+            best->lock.unlock();
+            continue;
+        }
+        Node result = take_top(*best);
+        best->lock.unlock();
+        return result;
+    }
+
+    // nearly empty: sweep every heap before reporting failure
+    for (size_t i = 0; i < shard_count_; ++i) {
+        Shard& shard = shards_[i];
+        if (shard.size.load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        shard.lock.lock();
+        if (!shard.heap.empty()) {
+            Node result = take_top(shard);
+            shard.lock.unlock();
+            return result;
+        }
+        shard.lock.unlock();
+    }
+    return std::nullopt;
+}
+
+template <typename T, typename Compare>
+size_t MultiQueue<T, Compare>::size_approx() const noexcept {
+    size_t total = 0;
+    for (size_t i = 0; i < shard_count_; ++i) {
+        total += shards_[i].size.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+template <typename T, typename Compare>
+bool MultiQueue<T, Compare>::empty_approx() const noexcept {
+    return size_approx() == 0;
+}
+
+template <typename T, typename Compare>
+size_t MultiQueue<T, Compare>::shard_count() const noexcept {
+    return shard_count_;
+}
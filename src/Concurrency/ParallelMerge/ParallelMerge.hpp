@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../../Containers/DynamicArray.hpp"
+#include "../../Containers/LoserTree.hpp"
+#include "../ThreadPool/ThreadPool.hpp"
+#include "../WaitGroup/WaitGroup.hpp"
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <utility>
+
+namespace ds::runtime {
+
+// Parallel stable k-way merge of sorted runs
+//
+// The output is cut into `parts` equal slices. Every slice is an independent task: it co-ranks
+// its two borders, i.e. finds how many elements of each run come before output position r,
+// and merges exactly those subranges with its own LoserTree straight into the shared result.
+// There is no sequential splitting step and the slices never overlap, so with enough parts
+// the merge is bound by memory bandwidth rather than by comparisons
+//
+// [condition] : the pool must be started, and the call blocks until the merge is done,
+//               so it must not be made from one of the pool's own workers
+// parts == 0 means one slice per hardware thread
+template <typename T, typename Compare = std::less<T>>
+containers::DynamicArray<T> parallel_merge(ThreadPool& pool, const containers::DynamicArray<containers::DynamicArray<T>>& runs,
+                                           size_t parts = 0, const Compare& compare = Compare());
+
+// Fills splits[m] with the number of elements of run m among the first rank merged elements
+// Narrows a bracket per run around pivots taken from the widest one, each pivot costs k binary searches
+// and the number of pivots depends on k and log n only, not on the output size
+template <typename T, typename Compare>
+void co_rank(const containers::DynamicArray<typename containers::LoserTree<T, Compare>::Run>& runs, size_t rank,
+             containers::DynamicArray<size_t>& splits, const Compare& compare);
+
+#include "ParallelMerge_inl.hpp"
+};  // namespace ds::runtime
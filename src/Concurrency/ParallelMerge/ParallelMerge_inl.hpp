@@ -0,0 +1,117 @@
+namespace detail {
+
+// Number of elements of `run` that precede element `index` of run `owner` in the stable merged
+// order: smaller ones, plus equal ones from the runs before the owner
+template <typename T, typename Compare>
+size_t preceding(const T* first, const T* last, size_t run, const T& value, size_t owner, size_t index, const Compare& compare) {
+    if (run == owner) {
+        return index;
+    }
+    size_t lo = 0;
+    size_t hi = static_cast<size_t>(last - first);
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        const bool before = run < owner ? !compare(value, first[mid]) : compare(first[mid], value);
+        if (before) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+}  // namespace detail
+
+template <typename T, typename Compare>
+void co_rank(const containers::DynamicArray<typename containers::LoserTree<T, Compare>::Run>& runs, size_t rank,
+             containers::DynamicArray<size_t>& splits, const Compare& compare) {
+    // the answer is bracketed per run: lo[m] <= splits[m] <= hi[m]
+    containers::DynamicArray<size_t> lo(runs.size(), 0);
+    containers::DynamicArray<size_t> hi(runs.size(), 0);
+    containers::DynamicArray<size_t> before(runs.size(), 0);
+    for (size_t m = 0; m < runs.size(); ++m) {
+        hi[m] = static_cast<size_t>(runs[m].last - runs[m].first);
+    }
+
+    while (true) {
+        // the pivot is the middle of the widest bracket, which halves it at least
+        size_t owner = 0;
+        for (size_t m = 1; m < runs.size(); ++m) {
+            owner = hi[m] - lo[m] > hi[owner] - lo[owner] ? m : owner;
+        }
+        if (runs.empty() || lo[owner] == hi[owner]) {
+            break;
+        }
+
+        const size_t index = lo[owner] + (hi[owner] - lo[owner]) / 2;
+        const T& pivot = runs[owner].first[index];
+        size_t pivot_rank = 0;
+        for (size_t m = 0; m < runs.size(); ++m) {
+            before[m] = detail::preceding(runs[m].first, runs[m].last, m, pivot, owner, index, compare);
+            pivot_rank += before[m];
+        }
+
+        if (pivot_rank == rank) {
+            lo = before;
+            break;
+        }
+        // everything before a pivot that is in the answer is in it too, and vice versa
+        for (size_t m = 0; m < runs.size(); ++m) {
+            if (pivot_rank < rank) {
+                lo[m] = before[m] > lo[m] ? before[m] : lo[m];
+            } else {
+                hi[m] = before[m] < hi[m] ? before[m] : hi[m];
+            }
+        }
+        if (pivot_rank < rank) {
+            lo[owner] = index + 1;
+        }
+    }
+
+    splits = std::move(lo);
+}
+
+template <typename T, typename Compare>
+containers::DynamicArray<T> parallel_merge(ThreadPool& pool, const containers::DynamicArray<containers::DynamicArray<T>>& runs, size_t parts,
+                                           const Compare& compare) {
+    using Tree = containers::LoserTree<T, Compare>;
+    using Run = typename Tree::Run;
+
+    const containers::DynamicArray<Run> all = Tree::as_runs(runs);
+    size_t total = 0;
+    for (size_t m = 0; m < all.size(); ++m) {
+        total += static_cast<size_t>(all[m].last - all[m].first);
+    }
+
+    containers::DynamicArray<T> result(total);
+    parts = parts == 0 ? std::thread::hardware_concurrency() : parts;
+    parts = parts == 0 ? 1 : parts;
+    parts = parts < total ? parts : (total == 0 ? 1 : total);
+
+    sync::WaitGroup wg;
+    wg.add(parts);
+    for (size_t part = 0; part < parts; ++part) {
+        pool.submit([&, part] {
+            const size_t begin = total * part / parts;
+            const size_t end = total * (part + 1) / parts;
+
+            containers::DynamicArray<size_t> from;
+            containers::DynamicArray<size_t> to;
+            co_rank<T>(all, begin, from, compare);
+            co_rank<T>(all, end, to, compare);
+
+            containers::DynamicArray<Run> slice;
+            slice.reserve(all.size());
+            for (size_t m = 0; m < all.size(); ++m) {
+                slice.push_back(Run{all[m].first + from[m], all[m].first + to[m]});
+            }
+
+            Tree tree(slice, compare);
+            tree.next_batch(result.begin() + begin, end - begin);
+            wg.done();
+        });
+    }
+    wg.wait();
+
+    return result;
+}
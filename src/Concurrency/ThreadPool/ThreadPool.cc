@@ -36,16 +36,45 @@ void ThreadPool::submit(Task task) {
         return;
     }
 
+    in_flight_.fetch_add(1, std::memory_order_relaxed);
     tasks_.push(std::move(task));
 }
 
+/// submits the task after the delay, the timing wheel behind timers_ makes this O(1)
+/// [condition] : it must be called after start() and before stop()
+TimerId ThreadPool::submit_after(std::chrono::steady_clock::duration delay, Task task) {
+    assert(started_ && !stopped_);
+
+    if (!task) {
+        return TimerId{};
+    }
+
+    return timers_.schedule(delay, [this, task = std::move(task)]() mutable {
+        submit(std::move(task));
+    });
+}
+
+bool ThreadPool::cancel(TimerId id) {
+    return timers_.cancel(id);
+}
+
 /// Stops the pool [waits for all worker threads to finish]
-/// => no new tasks will be submitted
+/// => delayed tasks still pending are submitted right away, then no new tasks will be submitted
 /// ![must be called only once]!
 void ThreadPool::stop() {
     // another ensuring that user follow stop rules
     assert(started_ && !stopped_);
 
+    // pending delayed tasks (e.g. wake-ups of sleeping fibers) are submitted now instead of being dropped
+    // and later submit_after() calls submit at once
+    timers_.flush();
+
+    // the tasks may still submit more (a woken fiber can yield or sleep again), so wait until
+    // nothing is queued or running before the queue stops accepting them
+    for (size_t n = in_flight_.load(std::memory_order_acquire); n != 0; n = in_flight_.load(std::memory_order_acquire)) {
+        in_flight_.wait(n, std::memory_order_acquire);
+    }
+
     stopped_.store(true);
 
     // closing the queue is th signal to worker threads to stop working for new tasks and exit their loop
@@ -93,6 +122,10 @@ void ThreadPool::worker_loop() {
 
             std::terminate();
         }
+
+        if (in_flight_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            in_flight_.notify_all();
+        }
     }
 }
 };  // namespace ds::runtime
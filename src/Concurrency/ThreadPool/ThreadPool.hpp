@@ -1,8 +1,10 @@
 #pragma once
 
+#include "../Timer/TimerService.hpp"
 #include "Queue.hpp"
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <functional>
 #include <thread>
@@ -22,6 +24,13 @@ class ThreadPool {
     const size_t num_threads_;
     std::vector<std::thread> workers_;
 
+    // delayed tasks wait here and are submitted once they are due
+    // the timer thread is only started by the first submit_after()
+    TimerService timers_;
+
+    // tasks submitted but not finished yet, stop() waits for it to drop to zero
+    std::atomic<size_t> in_flight_{0};
+
     // ensure visibility of state changes accross threads
     // they are atomic to safely sync with submit() method which can be called from any thread
     // !!! : A dedicated mutex isn't require here,
@@ -63,6 +72,14 @@ class ThreadPool {
 
     void submit(Task task);
 
+    // Submits the task once the delay has passed
+    // [condition] : same as submit(), delayed tasks that are still pending at stop() are submitted right away
+    // (so fibers parked in ds::fiber::sleep_for are resumed instead of leaking)
+    TimerId submit_after(std::chrono::steady_clock::duration delay, Task task);
+
+    // Returns false if the delayed task was already submitted or cancelled
+    bool cancel(TimerId id);
+
     /// TODO : [FEATURE] Implement std::future-based version of submit method for tasks that return values
     /// [this would allow the pool to handle tasks that return values]
     ///
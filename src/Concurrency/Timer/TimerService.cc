@@ -0,0 +1,137 @@
+#include "TimerService.hpp"
+#include <algorithm>
+
+namespace ds::runtime {
+
+TimerService::TimerService(Clock::duration resolution)
+    : resolution_(resolution > Clock::duration::zero() ? resolution : Clock::duration(1)),
+      epoch_(Clock::now()) {}
+
+TimerService::~TimerService() {
+    stop();
+}
+
+uint64_t TimerService::tick_before(Clock::time_point time) const {
+    return time <= epoch_ ? 0 : static_cast<uint64_t>((time - epoch_) / resolution_);
+}
+
+uint64_t TimerService::tick_after(Clock::time_point time) const {
+    return time <= epoch_ ? 0 : static_cast<uint64_t>((time - epoch_ + resolution_ - Clock::duration(1)) / resolution_);
+}
+
+TimerId TimerService::schedule(Clock::duration delay, Callback callback) {
+    return schedule_at(Clock::now() + delay, std::move(callback));
+}
+
+TimerId TimerService::schedule_at(Clock::time_point deadline, Callback callback) {
+    const uint64_t tick = tick_after(deadline);
+    bool wake = false;
+    bool run_now = false;
+    TimerId id;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_) {
+            run_now = flushed_;
+        } else {
+            if (!thread_.joinable()) {
+                thread_ = std::thread([this] {
+                    run();
+                });
+            }
+
+            id = wheel_.schedule_at(tick, std::move(callback));
+            // the timer thread only needs to be woken up if it sleeps past the new deadline
+            wake = tick < sleeping_until_;
+        }
+    }
+    if (run_now) {
+        // flushed, the callback runs outside the lock like on the timer thread
+        callback();
+    }
+    if (wake) {
+        wakeup_.notify_one();
+    }
+    return id;
+}
+
+bool TimerService::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return wheel_.cancel(id);
+}
+
+void TimerService::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    join();
+}
+
+void TimerService::flush() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+        flushed_ = true;
+    }
+    join();
+
+    // the timer thread is gone, so expired_ is ours now
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!wheel_.empty()) {
+        // next_expiry() is a lower bound, so some steps only cascade
+        const uint64_t next = std::max(*wheel_.next_expiry(), wheel_.now() + 1);
+        wheel_.advance_to(next, [this](Callback&& callback) {
+            expired_.push_back(std::move(callback));
+        });
+
+        lock.unlock();
+        for (auto& callback : expired_) {
+            callback();
+        }
+        expired_.clear();
+        lock.lock();
+    }
+}
+
+void TimerService::join() {
+    wakeup_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+size_t TimerService::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return wheel_.size();
+}
+
+void TimerService::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stopped_) {
+        wheel_.advance_to(tick_before(Clock::now()), [this](Callback&& callback) {
+            expired_.push_back(std::move(callback));
+        });
+
+        if (!expired_.empty()) {
+            // callbacks may schedule or cancel timers => run them without the lock
+            lock.unlock();
+            for (auto& callback : expired_) {
+                callback();
+            }
+            expired_.clear();
+            lock.lock();
+            continue;
+        }
+
+        if (auto next = wheel_.next_expiry()) {
+            sleeping_until_ = *next;
+            wakeup_.wait_until(lock, epoch_ + resolution_ * static_cast<Clock::rep>(*next));
+        } else {
+            sleeping_until_ = UINT64_MAX;
+            wakeup_.wait(lock);
+        }
+        sleeping_until_ = 0;
+    }
+}
+};  // namespace ds::runtime
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "../../Containers/DynamicArray.hpp"
+#include "TimingWheel.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace ds::runtime {
+
+// Runs callbacks after a delay on a dedicated timer thread
+// The timers live in a TimingWheel ticking at `resolution`, a callback fires at the first tick
+// at or after its deadline. The thread sleeps until the next deadline, not every tick
+//
+// Callbacks run on the timer thread and should be short (hand the real work to a ThreadPool)
+// The thread is started by the first schedule() call
+class TimerService {
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void()>;
+
+    explicit TimerService(Clock::duration resolution = std::chrono::milliseconds(1));
+
+    // Stops the service, pending callbacks are dropped
+    ~TimerService();
+
+    TimerService(const TimerService&) = delete;
+    TimerService(TimerService&&) = delete;
+    TimerService& operator=(const TimerService&) = delete;
+    TimerService& operator=(TimerService&&) = delete;
+
+    // Returns an id that is never armed if the service is already stopped (or flushed)
+    TimerId schedule(Clock::duration delay, Callback callback);
+
+    TimerId schedule_at(Clock::time_point deadline, Callback callback);
+
+    // Returns false if the callback already ran (or is running) or was cancelled
+    bool cancel(TimerId id);
+
+    // Joins the timer thread, pending callbacks are dropped
+    void stop();
+
+    // Joins the timer thread and runs the pending callbacks right away on the calling thread,
+    // in deadline order. Callbacks scheduled from then on run immediately on the scheduling thread
+    void flush();
+
+    size_t pending() const;
+
+  private:
+    uint64_t tick_before(Clock::time_point time) const;
+
+    uint64_t tick_after(Clock::time_point time) const;
+
+    void run();
+
+    void join();
+
+  private:
+    const Clock::duration resolution_;
+    const Clock::time_point epoch_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wakeup_;
+    TimingWheel<Callback> wheel_;
+    containers::DynamicArray<Callback> expired_;  // owned by the timer thread
+    uint64_t sleeping_until_ = UINT64_MAX;        // tick the timer thread waits for
+    bool stopped_ = false;
+    bool flushed_ = false;  // schedule() runs callbacks inline
+    std::thread thread_;
+};
+};  // namespace ds::runtime
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "../../Containers/DynamicArray.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+
+namespace ds::runtime {
+
+// Identifies an armed timer, stays unique after the timer fires or is cancelled
+struct TimerId {
+    uint32_t index = std::numeric_limits<uint32_t>::max();
+    uint32_t generation = 0;
+
+    bool operator==(const TimerId&) const = default;
+};
+
+// Hierarchical timing wheel (Varghese & Lauck) over an abstract tick counter
+//
+// LEVELS wheels of 64 slots, slot s of level l covers 64^l ticks. A timer lives on the level of
+// the highest 6-bit group in which its deadline differs from now(), so when now() enters a new
+// block of level l the timers of that slot are re-filed one level lower ("cascading"),
+// and level 0 slots only ever hold timers that expire exactly at that tick
+//
+//   schedule / cancel: O(1), the timers are nodes of intrusive lists in a pooled array
+//   advance:           O(expired + cascaded), empty stretches are skipped with per-level bitmaps
+//
+// Deadlines further than 64^LEVELS ticks wait in an overflow list that is re-filed every
+// 64^LEVELS ticks. Not thread-safe, TimerService adds the clock, the thread and the locking
+template <typename T>
+class TimingWheel {
+  private:
+    static constexpr size_t LEVELS = 6;
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t{1} << SLOT_BITS;
+    static constexpr size_t OVERFLOW_LIST = LEVELS * SLOTS;  // list index of the overflow timers
+    static constexpr uint32_t NIL = std::numeric_limits<uint32_t>::max();
+
+    struct Node {
+        uint64_t deadline = 0;
+        uint32_t prev = NIL;
+        uint32_t next = NIL;  // next free node while the node is free
+        uint32_t list = NIL;  // NIL while the node is free
+        uint32_t generation = 0;
+        std::optional<T> payload;
+    };
+
+    containers::DynamicArray<Node> nodes_;
+    uint32_t free_head_ = NIL;
+    uint32_t heads_[LEVELS * SLOTS + 1];
+    uint32_t tails_[LEVELS * SLOTS + 1];  // appending keeps equal deadlines in scheduling order
+    uint64_t occupied_[LEVELS] = {};  // bit s of level l is set while slot s isn't empty
+    uint64_t now_ = 0;
+    size_t size_ = 0;
+
+    uint32_t allocate_node();
+
+    void release_node(uint32_t index);
+
+    size_t list_for(uint64_t deadline) const noexcept;
+
+    void link(uint32_t index);
+
+    void unlink(uint32_t index);
+
+    // Re-files every timer of a list against the current time
+    void cascade(size_t list);
+
+    // First tick in (now_, limit] at which a slot has to be expired or cascaded
+    uint64_t next_stop(uint64_t limit) const noexcept;
+
+  public:
+    TimingWheel();
+
+    explicit TimingWheel(uint64_t start_tick);
+
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+
+    // Fires at tick now() + delay (at least one tick ahead)
+    TimerId schedule(uint64_t delay, T payload);
+
+    // Fires at the given tick, or at the next one if it's already reached
+    TimerId schedule_at(uint64_t deadline, T payload);
+
+    // O(1), returns false if the timer already fired or was cancelled
+    bool cancel(TimerId id);
+
+    bool is_armed(TimerId id) const noexcept;
+
+    // Moves the clock to tick `to`, calling on_expire(T&&) for every timer whose deadline is reached,
+    // in deadline order (scheduling order for equal deadlines). Callbacks may schedule and cancel timers
+    // Returns the number of expired timers
+    template <typename OnExpire>
+    size_t advance_to(uint64_t to, OnExpire&& on_expire);
+
+    template <typename OnExpire>
+    size_t advance(uint64_t ticks, OnExpire&& on_expire);
+
+    // Lower bound for the earliest deadline (exact when it is within the current 64-tick block),
+    // std::nullopt when no timer is armed. Sleeping until then never misses a timer
+    std::optional<uint64_t> next_expiry() const noexcept;
+
+    uint64_t now() const noexcept;
+
+    size_t size() const noexcept;
+
+    bool empty() const noexcept;
+
+    void reserve(size_t timers);
+};
+
+#include "TimingWheel_inl.hpp"
+};  // namespace ds::runtime
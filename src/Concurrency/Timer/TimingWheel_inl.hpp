@@ -0,0 +1,228 @@
+template <typename T>
+TimingWheel<T>::TimingWheel() : TimingWheel(0) {}
+
+template <typename T>
+TimingWheel<T>::TimingWheel(uint64_t start_tick) : now_(start_tick) {
+    for (size_t list = 0; list <= OVERFLOW_LIST; ++list) {
+        heads_[list] = NIL;
+        tails_[list] = NIL;
+    }
+}
+
+template <typename T>
+uint32_t TimingWheel<T>::allocate_node() {
+    if (free_head_ != NIL) {
+        const uint32_t index = free_head_;
+        free_head_ = nodes_[index].next;
+        return index;
+    }
+    nodes_.emplace_back();
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+template <typename T>
+void TimingWheel<T>::release_node(uint32_t index) {
+    Node& node = nodes_[index];
+    node.payload.reset();
+    node.list = NIL;
+    ++node.generation;
+    node.next = free_head_;
+    free_head_ = index;
+}
+
+template <typename T>
+size_t TimingWheel<T>::list_for(uint64_t deadline) const noexcept {
+    const uint64_t diff = deadline ^ now_;
+    const size_t level = diff == 0 ? 0 : static_cast<size_t>(std::bit_width(diff) - 1) / SLOT_BITS;
+    if (level >= LEVELS) {
+        return OVERFLOW_LIST;
+    }
+    return level * SLOTS + ((deadline >> (level * SLOT_BITS)) & (SLOTS - 1));
+}
+
+template <typename T>
+void TimingWheel<T>::link(uint32_t index) {
+    Node& node = nodes_[index];
+    const size_t list = list_for(node.deadline);
+
+    node.list = static_cast<uint32_t>(list);
+    node.prev = tails_[list];
+    node.next = NIL;
+    if (node.prev != NIL) {
+        nodes_[node.prev].next = index;
+    } else {
+        heads_[list] = index;
+    }
+    tails_[list] = index;
+
+    if (list != OVERFLOW_LIST) {
+        occupied_[list / SLOTS] |= uint64_t{1} << (list % SLOTS);
+    }
+}
+
+template <typename T>
+void TimingWheel<T>::unlink(uint32_t index) {
+    Node& node = nodes_[index];
+    const size_t list = node.list;
+
+    if (node.prev != NIL) {
+        nodes_[node.prev].next = node.next;
+    } else {
+        heads_[list] = node.next;
+    }
+    if (node.next != NIL) {
+        nodes_[node.next].prev = node.prev;
+    } else {
+        tails_[list] = node.prev;
+    }
+
+    if (heads_[list] == NIL && list != OVERFLOW_LIST) {
+        occupied_[list / SLOTS] &= ~(uint64_t{1} << (list % SLOTS));
+    }
+}
+
+template <typename T>
+void TimingWheel<T>::cascade(size_t list) {
+    uint32_t index = heads_[list];
+    heads_[list] = NIL;
+    tails_[list] = NIL;
+    if (list != OVERFLOW_LIST) {
+        occupied_[list / SLOTS] &= ~(uint64_t{1} << (list % SLOTS));
+    }
+
+    while (index != NIL) {
+        const uint32_t next = nodes_[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+template <typename T>
+uint64_t TimingWheel<T>::next_stop(uint64_t limit) const noexcept {
+    for (size_t level = 0; level < LEVELS; ++level) {
+        const size_t shift = level * SLOT_BITS;
+        const size_t current = (now_ >> shift) & (SLOTS - 1);
+        // every armed slot is ahead of the current one, the mask only guards the invariant
+        const uint64_t ahead = current == SLOTS - 1 ? 0 : occupied_[level] & (~uint64_t{0} << (current + 1));
+        if (ahead != 0) {
+            const size_t block_shift = shift + SLOT_BITS;
+            const uint64_t block = (now_ >> block_shift) << block_shift;
+            const uint64_t stop = block | (static_cast<uint64_t>(std::countr_zero(ahead)) << shift);
+            return stop < limit ? stop : limit;
+        }
+    }
+
+    if (heads_[OVERFLOW_LIST] != NIL) {
+        constexpr size_t span_bits = LEVELS * SLOT_BITS;
+        const uint64_t stop = ((now_ >> span_bits) + 1) << span_bits;
+        return stop < limit ? stop : limit;
+    }
+    return limit;
+}
+
+template <typename T>
+TimerId TimingWheel<T>::schedule(uint64_t delay, T payload) {
+    return schedule_at(now_ + delay, std::move(payload));
+}
+
+template <typename T>
+TimerId TimingWheel<T>::schedule_at(uint64_t deadline, T payload) {
+    const uint32_t index = allocate_node();
+    Node& node = nodes_[index];
+    node.deadline = deadline > now_ ? deadline : now_ + 1;
+    node.payload.emplace(std::move(payload));
+    link(index);
+    ++size_;
+    return TimerId{index, node.generation};
+}
+
+template <typename T>
+bool TimingWheel<T>::cancel(TimerId id) {
+    if (!is_armed(id)) {
+        return false;
+    }
+    unlink(id.index);
+    release_node(id.index);
+    --size_;
+    return true;
+}
+
+template <typename T>
+bool TimingWheel<T>::is_armed(TimerId id) const noexcept {
+    return id.index < nodes_.size() && nodes_[id.index].list != NIL && nodes_[id.index].generation == id.generation;
+}
+
+template <typename T>
+template <typename OnExpire>
+size_t TimingWheel<T>::advance_to(uint64_t to, OnExpire&& on_expire) {
+    size_t expired = 0;
+
+    while (now_ < to) {
+        if (size_ == 0) {
+            now_ = to;
+            break;
+        }
+
+        const uint64_t tick = next_stop(to);
+        now_ = tick;
+
+        // re-file the slots whose block starts at this tick, top-down so that
+        // timers dropping several levels are re-filed again on the way
+        if ((tick & ((uint64_t{1} << (LEVELS * SLOT_BITS)) - 1)) == 0) {
+            cascade(OVERFLOW_LIST);
+        }
+        for (size_t level = LEVELS - 1; level > 0; --level) {
+            const size_t shift = level * SLOT_BITS;
+            if ((tick & ((uint64_t{1} << shift) - 1)) == 0) {
+                cascade(level * SLOTS + ((tick >> shift) & (SLOTS - 1)));
+            }
+        }
+
+        // everything left in the level 0 slot expires exactly now
+        const size_t list = tick & (SLOTS - 1);
+        while (heads_[list] != NIL) {
+            const uint32_t index = heads_[list];
+            unlink(index);
+            T payload = std::move(*nodes_[index].payload);
+            release_node(index);
+            --size_;
+            ++expired;
+            on_expire(std::move(payload));
+        }
+    }
+    return expired;
+}
+
+template <typename T>
+template <typename OnExpire>
+size_t TimingWheel<T>::advance(uint64_t ticks, OnExpire&& on_expire) {
+    return advance_to(now_ + ticks, std::forward<OnExpire>(on_expire));
+}
+
+template <typename T>
+std::optional<uint64_t> TimingWheel<T>::next_expiry() const noexcept {
+    if (size_ == 0) {
+        return std::nullopt;
+    }
+    return next_stop(std::numeric_limits<uint64_t>::max());
+}
+
+template <typename T>
+uint64_t TimingWheel<T>::now() const noexcept {
+    return now_;
+}
+
+template <typename T>
+size_t TimingWheel<T>::size() const noexcept {
+    return size_;
+}
+
+template <typename T>
+bool TimingWheel<T>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T>
+void TimingWheel<T>::reserve(size_t timers) {
+    nodes_.reserve(timers);
+}
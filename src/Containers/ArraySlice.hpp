@@ -0,0 +1,176 @@
+#pragma once
+
+#include "../SmartPtrs/SharedPtr.hpp"
+#include "DynamicArray.hpp"
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::containers {
+
+template <typename T, typename Allocator = std::allocator<T>>
+class ArraySlice;
+
+// Immutable, reference-counted storage frozen from a DynamicArray
+// Freezing only moves the array's buffer into a make_shared control block, elements are never copied
+// Every ArraySlice taken from it keeps the storage alive
+template <typename T, typename Allocator = std::allocator<T>>
+class SharedBuffer {
+  private:
+    using Storage = DynamicArray<T, Allocator>;
+
+    smart_ptrs::SharedPtr<Storage> storage_;
+
+    friend class ArraySlice<T, Allocator>;
+
+  public:
+    using value_type = T;
+    using const_reference = const T&;
+    using const_iterator = const T*;
+
+    SharedBuffer() = default;
+
+    explicit SharedBuffer(Storage&& array) : storage_(smart_ptrs::make_shared<Storage>(std::move(array))) {}
+
+    const T* data() const noexcept {
+        return storage_ ? storage_->cbegin() : nullptr;
+    }
+
+    size_t size() const noexcept {
+        return storage_ ? storage_->size() : 0;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    const T& operator[](size_t index) const {
+        return data()[index];
+    }
+
+    const_iterator begin() const noexcept {
+        return data();
+    }
+
+    const_iterator end() const noexcept {
+        return data() + size();
+    }
+
+    // Number of buffers and slices sharing the storage
+    size_t use_count() const noexcept {
+        return storage_.use_count();
+    }
+
+    ArraySlice<T, Allocator> slice(size_t offset, size_t length) const {
+        return ArraySlice<T, Allocator>(*this).subslice(offset, length);
+    }
+
+    ArraySlice<T, Allocator> slice(size_t offset = 0) const {
+        return ArraySlice<T, Allocator>(*this).subslice(offset);
+    }
+};
+
+// Cheap read-only view into a SharedBuffer
+// Copying a slice costs one reference count increment, never an element copy
+template <typename T, typename Allocator>
+class ArraySlice {
+  private:
+    smart_ptrs::SharedPtr<DynamicArray<T, Allocator>> storage_;
+    const T* data_;
+    size_t size_;
+
+  public:
+    using value_type = T;
+    using const_reference = const T&;
+    using const_iterator = const T*;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    ArraySlice() noexcept : data_(nullptr), size_(0) {}
+
+    explicit ArraySlice(const SharedBuffer<T, Allocator>& buffer) : storage_(buffer.storage_), data_(buffer.data()), size_(buffer.size()) {}
+
+    const T* data() const noexcept {
+        return data_;
+    }
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    const T& operator[](size_t index) const {
+        return data_[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data_[index];
+    }
+
+    const T& front() const {
+        return data_[0];
+    }
+
+    const T& back() const {
+        return data_[size_ - 1];
+    }
+
+    const_iterator begin() const noexcept {
+        return data_;
+    }
+
+    const_iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    // Narrower view over [offset, offset + length) of this slice, sharing the same storage
+    ArraySlice subslice(size_t offset, size_t length) const {
+        if (offset > size_ || length > size_ - offset) {
+            throw std::out_of_range("Slice out of range");
+        }
+
+        ArraySlice result(*this);
+        result.data_ = data_ + offset;
+        result.size_ = length;
+        return result;
+    }
+
+    ArraySlice subslice(size_t offset) const {
+        if (offset > size_) {
+            throw std::out_of_range("Slice out of range");
+        }
+        return subslice(offset, size_ - offset);
+    }
+
+    // Number of buffers and slices sharing the storage
+    size_t use_count() const noexcept {
+        return storage_.use_count();
+    }
+
+    // Materializes the view into an independent mutable array (copies the elements)
+    DynamicArray<T, Allocator> to_array() const {
+        DynamicArray<T, Allocator> result;
+        result.assign(begin(), end());
+        return result;
+    }
+};
+
+template <typename T, typename Allocator>
+SharedBuffer<T, Allocator> freeze(DynamicArray<T, Allocator>&& array) {
+    return SharedBuffer<T, Allocator>(std::move(array));
+}
+}  // namespace ds::containers
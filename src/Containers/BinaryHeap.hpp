@@ -1,14 +1,23 @@
 #pragma once
 
 #include "DynamicArray.hpp"
+#include "HeapAlgorithms.hpp"
+#include <bit>
 #include <stdexcept>
 
 namespace ds::containers {
 
-template <typename T>
+// Min-heap over a DynamicArray
+// Arity is the number of children per node: 4 or 8 make the heap shallower and,
+// for small T, keep all children of a node in one cache line (see HeapAlgorithms.hpp)
+template <typename T, size_t Arity = 2>
 class BinaryHeap {
   private:
-    DynamicArray<T> data;
+    DynamicArray<T, HeapAllocator<T>> data;
+
+    static bool less(const T& a, const T& b) {
+        return a < b;
+    }
 
   public:
     BinaryHeap() = default;
@@ -17,6 +26,12 @@ class BinaryHeap {
 
     BinaryHeap(BinaryHeap&& other) noexcept : data(std::move(other.data)) {}
 
+    // Bulk construction with Floyd's heapify, O(n) instead of n sift-ups
+    explicit BinaryHeap(DynamicArray<T> elements);
+
+    template <typename InputIt>
+    BinaryHeap(InputIt first, InputIt last);
+
     ~BinaryHeap() = default;
 
     BinaryHeap& operator=(const BinaryHeap& other) {
@@ -39,6 +54,13 @@ class BinaryHeap {
 
     void insert(const T& item);
 
+    void insert(T&& item);
+
+    // Appends a batch, then either sifts up every new element or rebuilds the whole heap,
+    // whichever is cheaper: O(min(k log n, n + k))
+    template <typename InputIt>
+    void push_range(InputIt first, InputIt last);
+
     T extract_min();
 
     bool empty() const;
@@ -52,49 +74,73 @@ class BinaryHeap {
     DynamicArray<T> get_elements() const;
 };
 
-template <typename T>
-void BinaryHeap<T>::sift_down(size_t index) {
-    size_t left = 2 * index + 1;
-    size_t right = 2 * index + 2;
-    size_t smallest = index;
-
-    if (left < data.size() && data[left] < data[smallest]) {
-        smallest = left;
-    }
-    if (right < data.size() && data[right] < data[smallest]) {
-        smallest = right;
-    }
-    if (smallest != index) {
-        std::swap(data[index], data[smallest]);
-        sift_down(smallest);
+template <typename T, size_t Arity>
+BinaryHeap<T, Arity>::BinaryHeap(DynamicArray<T> elements) {
+    data.reserve(elements.size());
+    for (auto& item : elements) {
+        data.push_back(std::move(item));
     }
+    heap_make<Arity>(data.begin(), data.size(), less);
 }
 
-template <typename T>
-void BinaryHeap<T>::sift_up(size_t index) {
-    while (index > 0) {
-        size_t parent = (index - 1) / 2;
-        if (data[index] >= data[parent]) {
-            break;
-        }
-        std::swap(data[index], data[parent]);
-        index = parent;
+template <typename T, size_t Arity>
+template <typename InputIt>
+BinaryHeap<T, Arity>::BinaryHeap(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+        data.push_back(*first);
     }
+    heap_make<Arity>(data.begin(), data.size(), less);
+}
+
+template <typename T, size_t Arity>
+void BinaryHeap<T, Arity>::sift_down(size_t index) {
+    heap_sift_down<Arity>(data.begin(), data.size(), index, less);
 }
 
-template <typename T>
-void BinaryHeap<T>::insert(const T& item) {
+template <typename T, size_t Arity>
+void BinaryHeap<T, Arity>::sift_up(size_t index) {
+    heap_sift_up<Arity>(data.begin(), index, less);
+}
+
+template <typename T, size_t Arity>
+void BinaryHeap<T, Arity>::insert(const T& item) {
     data.push_back(item);
     sift_up(data.size() - 1);
 }
 
-template <typename T>
-T BinaryHeap<T>::extract_min() {
+template <typename T, size_t Arity>
+void BinaryHeap<T, Arity>::insert(T&& item) {
+    data.push_back(std::move(item));
+    sift_up(data.size() - 1);
+}
+
+template <typename T, size_t Arity>
+template <typename InputIt>
+void BinaryHeap<T, Arity>::push_range(InputIt first, InputIt last) {
+    const size_t old_size = data.size();
+    for (; first != last; ++first) {
+        data.push_back(*first);
+    }
+
+    const size_t added = data.size() - old_size;
+    if (added * static_cast<size_t>(std::bit_width(data.size())) >= data.size()) {
+        heap_make<Arity>(data.begin(), data.size(), less);
+    } else {
+        for (size_t i = old_size; i < data.size(); ++i) {
+            sift_up(i);
+        }
+    }
+}
+
+template <typename T, size_t Arity>
+T BinaryHeap<T, Arity>::extract_min() {
     if (data.empty()) {
         throw std::runtime_error("Heap is empty");
     }
-    T min_item = data[0];
-    data[0] = data[data.size() - 1];
+    T min_item = std::move(data[0]);
+    if (data.size() > 1) {
+        data[0] = std::move(data.back());
+    }
     data.pop_back();
     if (!data.empty()) {
         sift_down(0);
@@ -102,16 +148,16 @@ T BinaryHeap<T>::extract_min() {
     return min_item;
 }
 
-template <typename T>
-const T& BinaryHeap<T>::get_element(size_t index) const {
+template <typename T, size_t Arity>
+const T& BinaryHeap<T, Arity>::get_element(size_t index) const {
     if (index >= data.size()) {
         throw std::out_of_range("Index out of range");
     }
     return data[index];
 }
 
-template <typename T>
-void BinaryHeap<T>::set_element(size_t index, const T& value) {
+template <typename T, size_t Arity>
+void BinaryHeap<T, Arity>::set_element(size_t index, const T& value) {
     if (index >= data.size()) {
         throw std::out_of_range("Index out of range");
     }
@@ -120,18 +166,18 @@ void BinaryHeap<T>::set_element(size_t index, const T& value) {
     sift_down(index);
 }
 
-template <typename T>
-bool BinaryHeap<T>::empty() const {
+template <typename T, size_t Arity>
+bool BinaryHeap<T, Arity>::empty() const {
     return data.empty();
 }
 
-template <typename T>
-size_t BinaryHeap<T>::size() const {
+template <typename T, size_t Arity>
+size_t BinaryHeap<T, Arity>::size() const {
     return data.size();
 }
 
-template <typename T>
-DynamicArray<T> BinaryHeap<T>::get_elements() const {
+template <typename T, size_t Arity>
+DynamicArray<T> BinaryHeap<T, Arity>::get_elements() const {
     DynamicArray<T> elements;
     for (size_t i = 0; i < data.size(); ++i) {
         elements.push_back(data[i]);
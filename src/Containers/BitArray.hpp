@@ -0,0 +1,398 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace ds::containers {
+
+// Dynamic array of bits packed into 64-bit words
+// Bits past size() in the last word are always kept zero, so word-wide operations never see garbage
+class BitArray {
+  public:
+    using word_type = uint64_t;
+
+    static constexpr size_t WORD_BITS = 64;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+  private:
+    DynamicArray<word_type> words_;
+    size_t size_ = 0;
+
+    static constexpr size_t words_for(size_t bits) noexcept {
+        return (bits + WORD_BITS - 1) / WORD_BITS;
+    }
+
+    static constexpr word_type bit_mask(size_t index) noexcept {
+        return word_type{1} << (index % WORD_BITS);
+    }
+
+    // Clears the unused high bits of the last word
+    void trim() noexcept {
+        const size_t tail = size_ % WORD_BITS;
+        if (tail != 0) {
+            words_.back() &= (word_type{1} << tail) - 1;
+        }
+    }
+
+    void check_same_size(const BitArray& other) const {
+        if (size_ != other.size_) {
+            throw std::invalid_argument("BitArray sizes differ");
+        }
+    }
+
+  public:
+    BitArray() = default;
+
+    explicit BitArray(size_t size, bool value = false) : words_(words_for(size), value ? ~word_type{0} : word_type{0}), size_(size) {
+        trim();
+    }
+
+    bool operator[](size_t index) const {
+        return (words_[index / WORD_BITS] & bit_mask(index)) != 0;
+    }
+
+    bool test(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    void set(size_t index, bool value = true) {
+        if (value) {
+            words_[index / WORD_BITS] |= bit_mask(index);
+        } else {
+            words_[index / WORD_BITS] &= ~bit_mask(index);
+        }
+    }
+
+    void reset(size_t index) {
+        words_[index / WORD_BITS] &= ~bit_mask(index);
+    }
+
+    void flip(size_t index) {
+        words_[index / WORD_BITS] ^= bit_mask(index);
+    }
+
+    void set_all() noexcept {
+        for (auto& word : words_) {
+            word = ~word_type{0};
+        }
+        trim();
+    }
+
+    void reset_all() noexcept {
+        for (auto& word : words_) {
+            word = 0;
+        }
+    }
+
+    void flip_all() noexcept {
+        for (auto& word : words_) {
+            word = ~word;
+        }
+        trim();
+    }
+
+    void push_back(bool value) {
+        if (size_ % WORD_BITS == 0) {
+            words_.push_back(0);
+        }
+        ++size_;
+        set(size_ - 1, value);
+    }
+
+    void pop_back() {
+        if (size_ == 0) {
+            return;
+        }
+        --size_;
+        if (size_ % WORD_BITS == 0) {
+            words_.pop_back();
+        } else {
+            trim();
+        }
+    }
+
+    void resize(size_t new_size, bool value = false) {
+        const size_t old_size = size_;
+
+        words_.resize(words_for(new_size));
+        size_ = new_size;
+
+        if (new_size > old_size && value) {
+            // fill the tail of the old last word, then whole words
+            const size_t first_full = words_for(old_size);
+            for (size_t i = old_size; i < first_full * WORD_BITS && i < new_size; ++i) {
+                set(i);
+            }
+            for (size_t w = first_full; w < words_.size(); ++w) {
+                words_[w] = ~word_type{0};
+            }
+        }
+        trim();
+    }
+
+    void clear() noexcept {
+        words_.clear();
+        size_ = 0;
+    }
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_t word_count() const noexcept {
+        return words_.size();
+    }
+
+    const word_type* words() const noexcept {
+        return words_.cbegin();
+    }
+
+    // Number of set bits
+    // Four independent accumulators break the dependency chain between popcounts, so they overlap
+    // The build sets no -mpopcnt/-march flags: on baseline x86-64 std::popcount is a short bit-trick
+    // sequence (or a __popcountdi2 call), one popcnt instruction only where the target has it
+    size_t count() const noexcept {
+        const word_type* w = words_.cbegin();
+        const size_t n = words_.size();
+
+        size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            c0 += std::popcount(w[i]);
+            c1 += std::popcount(w[i + 1]);
+            c2 += std::popcount(w[i + 2]);
+            c3 += std::popcount(w[i + 3]);
+        }
+        for (; i < n; ++i) {
+            c0 += std::popcount(w[i]);
+        }
+        return c0 + c1 + c2 + c3;
+    }
+
+    bool any() const noexcept {
+        return find_first() != npos;
+    }
+
+    bool none() const noexcept {
+        return !any();
+    }
+
+    bool all() const noexcept {
+        return count() == size_;
+    }
+
+    // Index of the first set bit or npos
+    size_t find_first() const noexcept {
+        for (size_t w = 0; w < words_.size(); ++w) {
+            if (words_[w] != 0) {
+                return w * WORD_BITS + std::countr_zero(words_[w]);
+            }
+        }
+        return npos;
+    }
+
+    // Index of the first set bit strictly after pos or npos
+    size_t find_next(size_t pos) const noexcept {
+        ++pos;
+        if (pos >= size_) {
+            return npos;
+        }
+
+        size_t w = pos / WORD_BITS;
+        word_type word = words_[w] & (~word_type{0} << (pos % WORD_BITS));
+
+        for (;;) {
+            if (word != 0) {
+                return w * WORD_BITS + std::countr_zero(word);
+            }
+            if (++w == words_.size()) {
+                return npos;
+            }
+            word = words_[w];
+        }
+    }
+
+    BitArray& operator&=(const BitArray& other) {
+        check_same_size(other);
+        for (size_t w = 0; w < words_.size(); ++w) {
+            words_[w] &= other.words_[w];
+        }
+        return *this;
+    }
+
+    BitArray& operator|=(const BitArray& other) {
+        check_same_size(other);
+        for (size_t w = 0; w < words_.size(); ++w) {
+            words_[w] |= other.words_[w];
+        }
+        return *this;
+    }
+
+    BitArray& operator^=(const BitArray& other) {
+        check_same_size(other);
+        for (size_t w = 0; w < words_.size(); ++w) {
+            words_[w] ^= other.words_[w];
+        }
+        return *this;
+    }
+
+    // this &= ~other
+    BitArray& subtract(const BitArray& other) {
+        check_same_size(other);
+        for (size_t w = 0; w < words_.size(); ++w) {
+            words_[w] &= ~other.words_[w];
+        }
+        return *this;
+    }
+
+    BitArray operator~() const {
+        BitArray result(*this);
+        result.flip_all();
+        return result;
+    }
+
+    bool operator==(const BitArray& other) const noexcept {
+        if (size_ != other.size_) {
+            return false;
+        }
+        for (size_t w = 0; w < words_.size(); ++w) {
+            if (words_[w] != other.words_[w]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const BitArray& other) const noexcept {
+        return !(*this == other);
+    }
+};
+
+inline BitArray operator&(BitArray lhs, const BitArray& rhs) {
+    return lhs &= rhs;
+}
+
+inline BitArray operator|(BitArray lhs, const BitArray& rhs) {
+    return lhs |= rhs;
+}
+
+inline BitArray operator^(BitArray lhs, const BitArray& rhs) {
+    return lhs ^= rhs;
+}
+
+// Succinct rank/select directory over a BitArray
+// One cumulative count per 512-bit block (~12.5% overhead), so rank is O(1) and select is O(log n)
+// The index is a snapshot: it must be rebuilt after the bits change
+class RankSelectIndex {
+  private:
+    static constexpr size_t WORDS_PER_BLOCK = 8;
+    static constexpr size_t BLOCK_BITS = WORDS_PER_BLOCK * BitArray::WORD_BITS;
+
+    const BitArray* bits_ = nullptr;
+    DynamicArray<uint64_t> block_rank_;  // number of set bits before each block
+
+    // Position of the k-th (0-based) set bit inside a word
+    static size_t select_in_word(uint64_t word, size_t k) noexcept {
+        for (size_t i = 0; i < k; ++i) {
+            word &= word - 1;
+        }
+        return std::countr_zero(word);
+    }
+
+  public:
+    RankSelectIndex() = default;
+
+    explicit RankSelectIndex(const BitArray& bits) {
+        build(bits);
+    }
+
+    void build(const BitArray& bits) {
+        bits_ = &bits;
+        block_rank_.clear();
+
+        const size_t words = bits.word_count();
+        const BitArray::word_type* w = bits.words();
+
+        block_rank_.reserve(words / WORDS_PER_BLOCK + 2);
+
+        uint64_t total = 0;
+        for (size_t i = 0; i < words; ++i) {
+            if (i % WORDS_PER_BLOCK == 0) {
+                block_rank_.push_back(total);
+            }
+            total += std::popcount(w[i]);
+        }
+        block_rank_.push_back(total);  // sentinel with the total number of ones
+    }
+
+    size_t total_ones() const noexcept {
+        return block_rank_.empty() ? 0 : block_rank_.back();
+    }
+
+    // Number of set bits in [0, pos)
+    size_t rank1(size_t pos) const {
+        if (pos > bits_->size()) {
+            throw std::out_of_range("Index out of range (rank)");
+        }
+
+        const BitArray::word_type* w = bits_->words();
+        const size_t word = pos / BitArray::WORD_BITS;
+
+        size_t result = block_rank_[pos / BLOCK_BITS];
+        for (size_t i = (pos / BLOCK_BITS) * WORDS_PER_BLOCK; i < word; ++i) {
+            result += std::popcount(w[i]);
+        }
+
+        const size_t offset = pos % BitArray::WORD_BITS;
+        if (offset != 0) {
+            result += std::popcount(w[word] & ((uint64_t{1} << offset) - 1));
+        }
+        return result;
+    }
+
+    // Number of clear bits in [0, pos)
+    size_t rank0(size_t pos) const {
+        return pos - rank1(pos);
+    }
+
+    // Position of the k-th (0-based) set bit or BitArray::npos
+    size_t select1(size_t k) const {
+        if (k >= total_ones()) {
+            return BitArray::npos;
+        }
+
+        // last block whose cumulative rank is <= k
+        size_t lo = 0;
+        size_t hi = block_rank_.size() - 1;
+        while (hi - lo > 1) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (block_rank_[mid] <= k) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+
+        const BitArray::word_type* w = bits_->words();
+        size_t remaining = k - block_rank_[lo];
+
+        for (size_t i = lo * WORDS_PER_BLOCK;; ++i) {
+            const size_t ones = std::popcount(w[i]);
+            if (remaining < ones) {
+                return i * BitArray::WORD_BITS + select_in_word(w[i], remaining);
+            }
+            remaining -= ones;
+        }
+    }
+};
+}  // namespace ds::containers
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "PriorityQueue.hpp"
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::containers {
+
+// Calendar queue (R. Brown, 1988): min-priority queue for integer priorities
+// that are mostly consumed in increasing order (event simulation, timers)
+//
+// Priorities are split into "days" of width_ keys, and day d goes to bucket d % buckets.
+// extract_min only looks at the current day's bucket and moves on to the next one when it has
+// nothing left for today, so with the width tuned to ~3 elements per day both push and
+// extract_min are O(1) on average. The bucket count follows the size (doubling / halving),
+// and every resize re-estimates the width from the spread of the stored priorities
+//
+// Unlike RadixHeap an element below the current day is accepted, the cursor just jumps back
+//
+// Same push(priority, item) / extract_min interface as PriorityQueue, but the minimum wins
+template <typename T>
+class CalendarQueue {
+  private:
+    using Bucket = DynamicArray<PriorityNode<T>>;
+
+    static constexpr size_t MIN_BUCKETS = 2;
+    static constexpr size_t NPOS = std::numeric_limits<size_t>::max();
+
+    DynamicArray<Bucket> buckets_;  // power-of-two count
+    uint64_t width_ = 1;
+    size_t size_ = 0;
+
+    // The cursor only speeds up the next search, it doesn't change the contents
+    mutable size_t current_ = 0;  // bucket of the current day
+    mutable uint64_t day_ = 0;    // key / width_ of the current day
+
+    // Order-preserving map of signed priorities onto unsigned keys
+    static uint64_t key_of(long priority) noexcept {
+        return static_cast<uint64_t>(priority) ^ (uint64_t{1} << 63);
+    }
+
+    size_t bucket_for(uint64_t key) const noexcept {
+        return static_cast<size_t>(key / width_) & (buckets_.size() - 1);
+    }
+
+    void seek(uint64_t key) const noexcept {
+        current_ = bucket_for(key);
+        day_ = key / width_;
+    }
+
+    // Index of the minimum inside buckets_[current_], moving the cursor to its day
+    size_t locate() const {
+        for (size_t scanned = 0; scanned < buckets_.size(); ++scanned) {
+            const Bucket& bucket = buckets_[current_];
+            size_t best = NPOS;
+            for (size_t i = 0; i < bucket.size(); ++i) {
+                if (key_of(bucket[i].priority) / width_ <= day_ && (best == NPOS || bucket[i].priority < bucket[best].priority)) {
+                    best = i;
+                }
+            }
+            if (best != NPOS) {
+                return best;
+            }
+            current_ = (current_ + 1) & (buckets_.size() - 1);
+            ++day_;
+        }
+
+        // a whole year without a hit (sparse priorities): jump straight to the minimum
+        size_t best_bucket = 0;
+        size_t best = NPOS;
+        for (size_t b = 0; b < buckets_.size(); ++b) {
+            for (size_t i = 0; i < buckets_[b].size(); ++i) {
+                if (best == NPOS || buckets_[b][i].priority < buckets_[best_bucket][best].priority) {
+                    best_bucket = b;
+                    best = i;
+                }
+            }
+        }
+        seek(key_of(buckets_[best_bucket][best].priority));
+        return best;
+    }
+
+    void resize(size_t bucket_count) {
+        DynamicArray<PriorityNode<T>> all;
+        all.reserve(size_);
+        for (auto& bucket : buckets_) {
+            for (auto& node : bucket) {
+                all.push_back(std::move(node));
+            }
+        }
+
+        uint64_t min_key = std::numeric_limits<uint64_t>::max();
+        uint64_t max_key = 0;
+        for (size_t i = 0; i < all.size(); ++i) {
+            const uint64_t key = key_of(all[i].priority);
+            min_key = key < min_key ? key : min_key;
+            max_key = key > max_key ? key : max_key;
+        }
+
+        // three times the average gap between neighbouring priorities
+        width_ = all.empty() ? 1 : (max_key - min_key) / all.size();
+        width_ = width_ <= std::numeric_limits<uint64_t>::max() / 3 ? width_ * 3 : width_;
+        width_ = width_ == 0 ? 1 : width_;
+
+        buckets_ = DynamicArray<Bucket>(bucket_count);
+        for (auto& node : all) {
+            buckets_[bucket_for(key_of(node.priority))].push_back(std::move(node));
+        }
+        seek(all.empty() ? 0 : min_key);
+    }
+
+  public:
+    using value_type = PriorityNode<T>;
+    using const_reference = const value_type&;
+    using size_type = size_t;
+
+    CalendarQueue() : buckets_(MIN_BUCKETS) {}
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    size_type bucket_count() const noexcept {
+        return buckets_.size();
+    }
+
+    const_reference top() const {
+        if (empty()) {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        const size_t index = locate();  // may move the cursor
+        return buckets_[current_][index];
+    }
+
+    void push(const long priority, const T& item) {
+        const uint64_t key = key_of(priority);
+        if (empty() || key / width_ < day_) {
+            seek(key);
+        }
+
+        buckets_[bucket_for(key)].push_back(value_type(priority, item));
+        if (++size_ > 2 * buckets_.size()) {
+            resize(2 * buckets_.size());
+        }
+    }
+
+    void pop() {
+        if (empty()) {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        const size_t index = locate();  // may move the cursor
+        buckets_[current_].swap_and_pop(index);
+        if (--size_ < buckets_.size() / 2 && buckets_.size() > MIN_BUCKETS) {
+            resize(buckets_.size() / 2);
+        }
+    }
+
+    T extract_min() {
+        if (empty()) {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        const size_t index = locate();  // may move the cursor
+        T result = std::move(buckets_[current_][index].item);
+        buckets_[current_].swap_and_pop(index);
+        if (--size_ < buckets_.size() / 2 && buckets_.size() > MIN_BUCKETS) {
+            resize(buckets_.size() / 2);
+        }
+        return result;
+    }
+
+    void clear() noexcept {
+        for (auto& bucket : buckets_) {
+            bucket.clear();
+        }
+        size_ = 0;
+    }
+};
+}  // namespace ds::containers
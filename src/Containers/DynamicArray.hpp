@@ -2,13 +2,23 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <span>
 #include <stdexcept>
+#include <system_error>
+#include <type_traits>
 #include <utility>
 
+#if defined(__unix__) || defined(__APPLE__)
+#    include <cerrno>
+#    include <unistd.h>
+#endif
+
 namespace ds::containers {
 
 template <typename T, typename Allocator = std::allocator<T>>
@@ -336,19 +346,9 @@ class DynamicArray {
     }
 
     void erase(const T& value) {
-        size_t i = 0;
-        while (i < size_) {
-            if (data_[i] == value) {
-                std::allocator_traits<Allocator>::destroy(allocator_, data_ + i);
-                for (size_t j = i; j < size_ - 1; ++j) {
-                    std::allocator_traits<Allocator>::construct(allocator_, data_ + j, std::move(data_[j + 1]));
-                    std::allocator_traits<Allocator>::destroy(allocator_, data_ + j + 1);
-                }
-                --size_;
-            } else {
-                ++i;
-            }
-        }
+        erase_if([&value](const T& item) {
+            return item == value;
+        });
     }
 
     iterator erase(iterator pos) {
@@ -357,19 +357,126 @@ class DynamicArray {
         return begin() + index;
     }
 
+    // Removes [first, last) and shifts the tail down once
+    iterator erase(iterator first, iterator last) {
+        const size_t index = static_cast<size_t>(first - begin());
+        const size_t count = static_cast<size_t>(last - first);
+
+        if (index > size_ || count > size_ - index) {
+            throw std::out_of_range("Index out of range (erase)");
+        }
+        if (count == 0) {
+            return first;
+        }
+
+        destroy_range(data_ + index, data_ + index + count);
+        relocate_left(data_ + index, data_ + index + count, size_ - index - count);
+        size_ -= count;
+
+        return begin() + index;
+    }
+
     void erase_at_index(size_t index) {
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
+        erase(begin() + index, begin() + index + 1);
+    }
+
+    // Removes every element matching pred in a single pass, keeping the order of the rest
+    // Returns the number of removed elements
+    template <typename Pred>
+    size_t erase_if(Pred pred) {
+        size_t write = 0;
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            // move whole runs of survivors at once instead of element by element
+            // removed caches the verdict for data_[read], so pred sees every element exactly once
+            size_t read = 0;
+            bool removed = size_ != 0 && pred(data_[0]);
+            auto advance = [&] {
+                ++read;
+                removed = read < size_ && pred(data_[read]);
+            };
+            while (read < size_) {
+                while (read < size_ && removed) {
+                    advance();
+                }
+                const size_t run_begin = read;
+                while (read < size_ && !removed) {
+                    advance();
+                }
+                const size_t run_length = read - run_begin;
+                if (run_length != 0 && write != run_begin) {
+                    std::memmove(static_cast<void*>(data_ + write), static_cast<const void*>(data_ + run_begin), run_length * sizeof(T));
+                }
+                write += run_length;
+            }
+        } else {
+            // like std::remove_if: survivors are move-assigned down and every slot stays alive
+            // until the loop is over, so a throwing pred leaves no destroyed elements behind
+            for (size_t read = 0; read < size_; ++read) {
+                if (!pred(data_[read])) {
+                    if (write != read) {
+                        data_[write] = std::move(data_[read]);
+                    }
+                    ++write;
+                }
+            }
+        }
+
+        const size_t removed = size_ - write;
+        destroy_range(data_ + write, data_ + size_);
+        size_ = write;
+        return removed;
+    }
+
+    // Collapses runs of equal adjacent elements (all duplicates if the array is sorted)
+    // Returns the number of removed elements
+    size_t remove_duplicates() {
+        return remove_duplicates(std::equal_to<T>());
+    }
+
+    // Same as above, but keeps the first element of every run of elements equal by pred
+    template <typename BinaryPred>
+    size_t remove_duplicates(BinaryPred equal) {
+        if (size_ < 2) {
+            return 0;
+        }
 
-        std::allocator_traits<Allocator>::destroy(allocator_, data_ + index);
+        // same scheme as erase_if: nothing is destroyed before the loop is over
+        size_t write = 1;
+        for (size_t read = 1; read < size_; ++read) {
+            if (!equal(data_[write - 1], data_[read])) {
+                if (write != read) {
+                    data_[write] = std::move(data_[read]);
+                }
+                ++write;
+            }
+        }
 
-        for (size_t i = index; i < size_ - 1; ++i) {
-            std::allocator_traits<Allocator>::construct(allocator_, data_ + i, std::move(data_[i + 1]));
-            std::allocator_traits<Allocator>::destroy(allocator_, data_ + i + 1);
+        const size_t removed = size_ - write;
+        destroy_range(data_ + write, data_ + size_);
+        size_ = write;
+        return removed;
+    }
+
+    // O(1) erase that doesn't preserve order: the last element takes the place of the removed one
+    void swap_and_pop(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range (swap_and_pop)");
         }
 
-        --size_;
+        if (index != size_ - 1) {
+            data_[index] = std::move(data_[size_ - 1]);
+        }
+        pop_back();
+    }
+
+    iterator swap_and_pop(iterator pos) {
+        const size_t index = static_cast<size_t>(pos - begin());
+        swap_and_pop(index);
+        return begin() + index;
     }
 
     void reserve(size_t new_capacity) {
@@ -403,6 +510,82 @@ class DynamicArray {
         size_ = new_size;
     }
 
+    // Like resize(), but new elements are default-initialized
+    // so trivial types are left as raw memory to be overwritten by the caller
+    void resize_for_overwrite(size_t new_size) {
+        if (new_size <= size_) {
+            resize(new_size);
+            return;
+        }
+
+        if (new_size > capacity_) {
+            reserve(new_size);
+        }
+        default_init_range(data_ + size_, data_ + new_size);
+        size_ = new_size;
+    }
+
+    // Grows the array by count default-initialized elements and returns a view over them
+    std::span<T> append_uninitialized(size_t count) {
+        const size_t old_size = size_;
+
+        if (size_ + count > capacity_) {
+            reserve(std::max(capacity_ * 2, size_ + count));
+        }
+        default_init_range(data_ + size_, data_ + size_ + count);
+        size_ += count;
+
+        return std::span<T>(data_ + old_size, count);
+    }
+
+    // Lets producer write directly into the tail of the array
+    // producer(T* dst, size_t max_count) must return the number of elements it has written
+    // Returns the number of appended elements
+    template <typename Producer>
+        requires std::is_invocable_r_v<size_t, Producer, T*, size_t>
+    size_t append_from(Producer&& producer, size_t max_count) {
+        const size_t old_size = size_;
+        std::span<T> tail = append_uninitialized(max_count);
+
+        size_t produced = 0;
+        try {
+            produced = std::forward<Producer>(producer)(tail.data(), max_count);
+        } catch (...) {
+            resize(old_size);
+            throw;
+        }
+
+        if (produced > max_count) {
+            resize(old_size);
+            throw std::length_error("Producer wrote past the requested range (append_from)");
+        }
+
+        resize(old_size + produced);
+        return produced;
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    // Reads up to max_bytes from the file descriptor straight into the array (a single read(2) call)
+    // Returns the number of appended bytes, 0 on EOF
+    size_t append_from(int fd, size_t max_bytes) {
+        static_assert(sizeof(T) == 1 && std::is_trivially_copyable_v<T>, "append_from(fd) requires a byte-sized element type");
+
+        auto read_fd = [fd](T* dst, size_t max_count) -> size_t {
+            for (;;) {
+                ssize_t n = ::read(fd, dst, max_count);
+                if (n >= 0) {
+                    return static_cast<size_t>(n);
+                }
+                if (errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(), "read failed (append_from)");
+                }
+            }
+        };
+
+        return append_from(read_fd, max_bytes);
+    }
+#endif
+
     void clear() noexcept {
         for (size_t i = 0; i < size_; ++i) {
             std::allocator_traits<Allocator>::destroy(allocator_, data_ + i);
@@ -421,5 +604,45 @@ class DynamicArray {
     bool empty() const noexcept {
         return size_ == 0;
     }
+
+  private:
+    void default_init_range(T* first, T* last) {
+        if constexpr (!std::is_trivially_default_constructible_v<T>) {
+            T* current = first;
+            try {
+                for (; current != last; ++current) {
+                    std::allocator_traits<Allocator>::construct(allocator_, current);
+                }
+            } catch (...) {
+                destroy_range(first, current);
+                throw;
+            }
+        }
+    }
+
+    void destroy_range(T* first, T* last) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (; first != last; ++first) {
+                std::allocator_traits<Allocator>::destroy(allocator_, first);
+            }
+        }
+    }
+
+    // Moves count elements from src down to dst (dst <= src), leaving [src, src + count) destroyed
+    // Trivially copyable types are relocated with a single memmove
+    void relocate_left(T* dst, T* src, size_t count) {
+        if (count == 0 || dst == src) {
+            return;
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                std::allocator_traits<Allocator>::construct(allocator_, dst + i, std::move(src[i]));
+                std::allocator_traits<Allocator>::destroy(allocator_, src + i);
+            }
+        }
+    }
 };
 }  // namespace ds::containers
@@ -0,0 +1,368 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "FlatSearch.hpp"
+#include "Pair.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ds::containers {
+
+// Ordered map stored as two parallel sorted DynamicArrays (keys and values)
+// Searches only touch the key array, so more keys fit in every cache line
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Search = BranchlessSearch<Key, Compare>>
+class FlatMap {
+  private:
+    DynamicArray<Key> keys_;
+    DynamicArray<Value> values_;
+    Compare comp_;
+    Search search_;
+
+    void rebuild_index() {
+        search_.rebuild(keys_.cbegin(), keys_.size());
+    }
+
+    size_t lower_bound_index(const Key& key) const {
+        return search_.lower_bound(keys_.cbegin(), keys_.size(), key, comp_);
+    }
+
+    size_t find_index(const Key& key) const {
+        const size_t index = lower_bound_index(key);
+        return (index != keys_.size() && !comp_(key, keys_[index])) ? index : keys_.size();
+    }
+
+  public:
+    template <bool is_const>
+    struct EntryRef {
+        const Key& first;
+        std::conditional_t<is_const, const Value&, Value&> second;
+    };
+
+    template <bool is_const>
+    class Iterator {
+      private:
+        using MapPtr = std::conditional_t<is_const, const FlatMap*, FlatMap*>;
+
+        MapPtr map_;
+        size_t index_;
+
+        struct ArrowProxy {
+            EntryRef<is_const> ref;
+
+            const EntryRef<is_const>* operator->() const {
+                return &ref;
+            }
+        };
+
+        friend class FlatMap;
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = EntryRef<is_const>;
+        using difference_type = std::ptrdiff_t;
+        using reference = EntryRef<is_const>;
+        using pointer = ArrowProxy;
+
+        Iterator() : map_(nullptr), index_(0) {}
+
+        Iterator(MapPtr map, size_t index) : map_(map), index_(index) {}
+
+        // iterator => const_iterator
+        template <bool other_const>
+            requires(is_const && !other_const)
+        Iterator(const Iterator<other_const>& other) : map_(other.map_), index_(other.index_) {}
+
+        reference operator*() const {
+            return reference{map_->keys_[index_], map_->values_[index_]};
+        }
+
+        pointer operator->() const {
+            return ArrowProxy{**this};
+        }
+
+        Iterator& operator++() {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator tmp = *this;
+            ++index_;
+            return tmp;
+        }
+
+        Iterator& operator--() {
+            --index_;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator tmp = *this;
+            --index_;
+            return tmp;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return map_ == other.map_ && index_ == other.index_;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+
+        size_t index() const noexcept {
+            return index_;
+        }
+
+        template <bool>
+        friend class Iterator;
+    };
+
+    using key_type = Key;
+    using mapped_type = Value;
+    using key_compare = Compare;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatMap() = default;
+
+    explicit FlatMap(const Compare& comp) : comp_(comp) {}
+
+    FlatMap(std::initializer_list<Pair<Key, Value>> init, const Compare& comp = Compare()) : comp_(comp) {
+        insert(init.begin(), init.end());
+    }
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, keys_.size());
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, keys_.size());
+    }
+
+    size_t size() const noexcept {
+        return keys_.size();
+    }
+
+    bool empty() const noexcept {
+        return keys_.empty();
+    }
+
+    void reserve(size_t new_capacity) {
+        keys_.reserve(new_capacity);
+        values_.reserve(new_capacity);
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        values_.clear();
+        search_.rebuild(nullptr, 0);
+    }
+
+    key_compare key_comp() const {
+        return comp_;
+    }
+
+    // Sorted keys, contiguous
+    const Key* keys() const noexcept {
+        return keys_.cbegin();
+    }
+
+    // Values in key order, contiguous
+    const Value* values() const noexcept {
+        return values_.cbegin();
+    }
+
+    // Lookup
+
+    iterator lower_bound(const Key& key) {
+        return iterator(this, lower_bound_index(key));
+    }
+
+    const_iterator lower_bound(const Key& key) const {
+        return const_iterator(this, lower_bound_index(key));
+    }
+
+    iterator upper_bound(const Key& key) {
+        return iterator(this, upper_bound_index(key));
+    }
+
+    const_iterator upper_bound(const Key& key) const {
+        return const_iterator(this, upper_bound_index(key));
+    }
+
+    iterator find(const Key& key) {
+        return iterator(this, find_index(key));
+    }
+
+    const_iterator find(const Key& key) const {
+        return const_iterator(this, find_index(key));
+    }
+
+    bool contains(const Key& key) const {
+        return find_index(key) != keys_.size();
+    }
+
+    // Entries with keys in [low, high)
+    Pair<iterator, iterator> range(const Key& low, const Key& high) {
+        return Pair<iterator, iterator>(lower_bound(low), lower_bound(high));
+    }
+
+    Pair<const_iterator, const_iterator> range(const Key& low, const Key& high) const {
+        return Pair<const_iterator, const_iterator>(lower_bound(low), lower_bound(high));
+    }
+
+    Value& at(const Key& key) {
+        const size_t index = find_index(key);
+        if (index == keys_.size()) {
+            throw std::out_of_range("Key not found");
+        }
+        return values_[index];
+    }
+
+    const Value& at(const Key& key) const {
+        const size_t index = find_index(key);
+        if (index == keys_.size()) {
+            throw std::out_of_range("Key not found");
+        }
+        return values_[index];
+    }
+
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first_->second;
+    }
+
+    // Modifiers
+
+    template <typename... Args>
+    Pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        const size_t index = lower_bound_index(key);
+        if (index != keys_.size() && !comp_(key, keys_[index])) {
+            return Pair<iterator, bool>(iterator(this, index), false);
+        }
+
+        // both copies are made up front, then a failed key insert (growth) only has the value to undo
+        Key new_key(key);
+        values_.insert(index, Value(std::forward<Args>(args)...));
+        try {
+            keys_.insert(index, std::move(new_key));
+        } catch (...) {
+            values_.erase(index);  // keeps the parallel arrays in step
+            throw;
+        }
+        rebuild_index();
+        return Pair<iterator, bool>(iterator(this, index), true);
+    }
+
+    template <typename V>
+    Pair<iterator, bool> insert(const Key& key, V&& value) {
+        return try_emplace(key, std::forward<V>(value));
+    }
+
+    template <typename V>
+    Pair<iterator, bool> insert_or_assign(const Key& key, V&& value) {
+        auto result = try_emplace(key, std::forward<V>(value));
+        if (!result.second_) {
+            values_[result.first_.index()] = std::forward<V>(value);
+        }
+        return result;
+    }
+
+    // Batch insert of Pair<Key, Value>-like entries (anything with first_/second_)
+    // The new entries are sorted once and merged with the existing ones in a single linear pass
+    // Keys already present (and later duplicates inside the batch) are ignored
+    template <typename InputIt>
+        requires std::input_iterator<InputIt>
+    void insert(InputIt first, InputIt last) {
+        DynamicArray<Pair<Key, Value>> incoming;
+        for (; first != last; ++first) {
+            incoming.emplace_back(first->first_, first->second_);
+        }
+        if (incoming.empty()) {
+            return;
+        }
+
+        auto by_key = [this](const Pair<Key, Value>& a, const Pair<Key, Value>& b) {
+            return comp_(a.first_, b.first_);
+        };
+        std::stable_sort(incoming.begin(), incoming.end(), by_key);
+
+        DynamicArray<Key> merged_keys;
+        DynamicArray<Value> merged_values;
+        merged_keys.reserve(keys_.size() + incoming.size());
+        merged_values.reserve(keys_.size() + incoming.size());
+
+        auto append = [&](Key&& key, Value&& value) {
+            if (!merged_keys.empty() && !comp_(merged_keys.back(), key)) {
+                return;  // equivalent to the last kept key
+            }
+            merged_keys.push_back(std::move(key));
+            merged_values.push_back(std::move(value));
+        };
+
+        size_t i = 0;
+        size_t j = 0;
+        while (i < keys_.size() || j < incoming.size()) {
+            // existing entries win ties
+            if (j == incoming.size() || (i < keys_.size() && !comp_(incoming[j].first_, keys_[i]))) {
+                append(std::move(keys_[i]), std::move(values_[i]));
+                ++i;
+            } else {
+                append(std::move(incoming[j].first_), std::move(incoming[j].second_));
+                ++j;
+            }
+        }
+
+        keys_ = std::move(merged_keys);
+        values_ = std::move(merged_values);
+        rebuild_index();
+    }
+
+    size_t erase(const Key& key) {
+        const size_t index = find_index(key);
+        if (index == keys_.size()) {
+            return 0;
+        }
+        erase_index(index);
+        return 1;
+    }
+
+    iterator erase(const_iterator pos) {
+        erase_index(pos.index());
+        return iterator(this, pos.index());
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        keys_.erase(keys_.begin() + first.index(), keys_.begin() + last.index());
+        values_.erase(values_.begin() + first.index(), values_.begin() + last.index());
+        rebuild_index();
+        return iterator(this, first.index());
+    }
+
+  private:
+    size_t upper_bound_index(const Key& key) const {
+        return branchless_partition_point(keys_.cbegin(), keys_.size(), [&](const Key& x) {
+            return !comp_(key, x);
+        });
+    }
+
+    void erase_index(size_t index) {
+        keys_.erase_at_index(index);
+        values_.erase_at_index(index);
+        rebuild_index();
+    }
+};
+}  // namespace ds::containers
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include <bit>
+#include <cstddef>
+
+#if defined(__GNUC__) || defined(__clang__)
+#    define DS_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#    define DS_PREFETCH(addr) static_cast<void>(0)
+#endif
+
+namespace ds::containers {
+
+// Branchless binary search: index of the first element in [0, n) for which less(keys[i]) is false
+// The loop body compiles to a conditional move, both possible next probes are prefetched
+template <typename Key, typename Less>
+size_t branchless_partition_point(const Key* keys, size_t n, Less less) {
+    if (n == 0) {
+        return 0;
+    }
+
+    const Key* base = keys;
+    while (n > 1) {
+        const size_t half = n / 2;
+        DS_PREFETCH(base + half / 2);
+        DS_PREFETCH(base + half + half / 2);
+        base = less(base[half]) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<size_t>(base - keys) + (less(*base) ? 1 : 0);
+}
+
+// Search policy that probes the sorted array directly (no extra memory)
+template <typename Key, typename Compare>
+class BranchlessSearch {
+  public:
+    void rebuild(const Key*, size_t) {}
+
+    size_t lower_bound(const Key* keys, size_t n, const Key& key, const Compare& comp) const {
+        return branchless_partition_point(keys, n, [&](const Key& x) {
+            return comp(x, key);
+        });
+    }
+};
+
+// Search policy that keeps a copy of the keys in Eytzinger (BFS) order next to the sorted array
+// Nodes visited in the first levels of every search share cache lines, and the 16 descendants
+// four levels down are contiguous, so a single prefetch covers them
+// Costs one extra copy of the keys plus a rank per key, rebuilt in O(n) after every modification
+template <typename Key, typename Compare>
+class EytzingerSearch {
+  private:
+    DynamicArray<Key> tree_;    // 1-based, tree_[0] is unused
+    DynamicArray<size_t> rank_;  // tree index => position in the sorted array
+
+    size_t fill(const Key* keys, size_t n, size_t i, size_t k) {
+        if (k <= n) {
+            i = fill(keys, n, i, 2 * k);
+            tree_[k] = keys[i];
+            rank_[k] = i;
+            ++i;
+            i = fill(keys, n, i, 2 * k + 1);
+        }
+        return i;
+    }
+
+  public:
+    void rebuild(const Key* keys, size_t n) {
+        tree_.clear();
+        rank_.clear();
+        if (n == 0) {
+            return;
+        }
+
+        tree_.resize(n + 1);
+        rank_.resize(n + 1);
+        fill(keys, n, 0, 1);
+    }
+
+    size_t lower_bound(const Key*, size_t n, const Key& key, const Compare& comp) const {
+        if (tree_.empty()) {
+            return 0;
+        }
+
+        const Key* tree = tree_.cbegin();
+        size_t k = 1;
+        while (k <= n) {
+            DS_PREFETCH(tree + 16 * k);
+            k = 2 * k + (comp(tree[k], key) ? 1 : 0);
+        }
+
+        // strip the trailing right turns (ones) and the last left turn
+        k >>= std::countr_one(k) + 1;
+        return k == 0 ? n : rank_[k];
+    }
+};
+}  // namespace ds::containers
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "FlatSearch.hpp"
+#include "Pair.hpp"
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+
+namespace ds::containers {
+
+// Ordered set stored as a sorted DynamicArray
+// Lookups are cache-friendly binary searches, single inserts/erases shift the tail,
+// batch inserts sort the new keys and merge them in one pass
+template <typename Key, typename Compare = std::less<Key>, typename Search = BranchlessSearch<Key, Compare>>
+class FlatSet {
+  private:
+    DynamicArray<Key> keys_;
+    Compare comp_;
+    Search search_;
+
+    bool equivalent(const Key& a, const Key& b) const {
+        return !comp_(a, b) && !comp_(b, a);
+    }
+
+    void rebuild_index() {
+        search_.rebuild(keys_.cbegin(), keys_.size());
+    }
+
+    size_t lower_bound_index(const Key& key) const {
+        return search_.lower_bound(keys_.cbegin(), keys_.size(), key, comp_);
+    }
+
+  public:
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using const_reference = const Key&;
+    using iterator = const Key*;
+    using const_iterator = const Key*;
+    using reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    FlatSet() = default;
+
+    explicit FlatSet(const Compare& comp) : comp_(comp) {}
+
+    template <typename InputIt>
+    FlatSet(InputIt first, InputIt last, const Compare& comp = Compare()) : comp_(comp) {
+        insert(first, last);
+    }
+
+    FlatSet(std::initializer_list<Key> init, const Compare& comp = Compare()) : comp_(comp) {
+        insert(init.begin(), init.end());
+    }
+
+    const_iterator begin() const noexcept {
+        return keys_.cbegin();
+    }
+
+    const_iterator end() const noexcept {
+        return keys_.cend();
+    }
+
+    reverse_iterator rbegin() const noexcept {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() const noexcept {
+        return reverse_iterator(begin());
+    }
+
+    size_t size() const noexcept {
+        return keys_.size();
+    }
+
+    bool empty() const noexcept {
+        return keys_.empty();
+    }
+
+    void reserve(size_t new_capacity) {
+        keys_.reserve(new_capacity);
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        search_.rebuild(nullptr, 0);
+    }
+
+    key_compare key_comp() const {
+        return comp_;
+    }
+
+    // Lookup
+
+    const_iterator lower_bound(const Key& key) const {
+        return begin() + lower_bound_index(key);
+    }
+
+    const_iterator upper_bound(const Key& key) const {
+        return begin() + branchless_partition_point(keys_.cbegin(), keys_.size(), [&](const Key& x) {
+                   return !comp_(key, x);
+               });
+    }
+
+    const_iterator find(const Key& key) const {
+        const_iterator it = lower_bound(key);
+        return (it != end() && !comp_(key, *it)) ? it : end();
+    }
+
+    bool contains(const Key& key) const {
+        return find(key) != end();
+    }
+
+    size_t count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    // Keys in [low, high)
+    Pair<const_iterator, const_iterator> range(const Key& low, const Key& high) const {
+        return Pair<const_iterator, const_iterator>(lower_bound(low), lower_bound(high));
+    }
+
+    // Modifiers
+
+    template <typename K>
+    Pair<const_iterator, bool> insert(K&& key) {
+        const size_t index = lower_bound_index(key);
+        if (index != keys_.size() && !comp_(key, keys_[index])) {
+            return Pair<const_iterator, bool>(begin() + index, false);
+        }
+
+        keys_.insert(index, std::forward<K>(key));
+        rebuild_index();
+        return Pair<const_iterator, bool>(begin() + index, true);
+    }
+
+    // Batch insert: appends the new keys, sorts them and merges with the existing ones
+    // O(n + m log m) instead of m tail shifts; keys already present are kept as they were
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        const size_t old_size = keys_.size();
+        for (; first != last; ++first) {
+            keys_.push_back(*first);
+        }
+        if (keys_.size() == old_size) {
+            return;
+        }
+
+        Key* data = keys_.begin();
+        Key* middle = data + old_size;
+        Key* tail = keys_.end();
+
+        // stable sort + stable merge keep the earliest equivalent key first, so it survives deduplication
+        std::stable_sort(middle, tail, comp_);
+        std::inplace_merge(data, middle, tail, comp_);
+        keys_.remove_duplicates([this](const Key& a, const Key& b) {
+            return equivalent(a, b);
+        });
+
+        rebuild_index();
+    }
+
+    void insert(std::initializer_list<Key> ilist) {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    size_t erase(const Key& key) {
+        const_iterator it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    const_iterator erase(const_iterator pos) {
+        const size_t index = static_cast<size_t>(pos - begin());
+        keys_.erase_at_index(index);
+        rebuild_index();
+        return begin() + index;
+    }
+
+    const_iterator erase(const_iterator first, const_iterator last) {
+        const size_t index = static_cast<size_t>(first - begin());
+        keys_.erase(keys_.begin() + index, keys_.begin() + (last - begin()));
+        rebuild_index();
+        return begin() + index;
+    }
+
+    template <typename Pred>
+    size_t erase_if(Pred pred) {
+        const size_t removed = keys_.erase_if(pred);
+        if (removed != 0) {
+            rebuild_index();
+        }
+        return removed;
+    }
+};
+}  // namespace ds::containers
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace ds::containers {
+
+// Array-based d-ary heap primitives shared by BinaryHeap and PriorityQueue
+// The children of node i are Arity * i + 1 ... Arity * i + Arity, the parent is (i - 1) / Arity
+// before(a, b) says that a belongs closer to the root than b
+// data is a random-access iterator to the first element (a plain pointer in the array-backed heaps)
+//
+// Sifting is iterative and moves a "hole" instead of swapping: the element being sifted
+// is held aside and written exactly once, every level costs a single move
+// Wider heaps are shallower (log_d n levels), and with HeapAllocator all children of a node
+// share one cache line, so a level costs at most one miss even though it compares Arity keys
+//
+// track(element, index) is called whenever an element lands at a new index,
+// which is how indexed heaps keep their position maps up to date
+
+struct HeapNoTrack {
+    template <typename T>
+    void operator()(const T&, size_t) const noexcept {}
+};
+
+template <size_t Arity, std::random_access_iterator RandomIt, typename Before, typename Track = HeapNoTrack>
+void heap_sift_up(RandomIt data, size_t index, Before before, Track track = Track()) {
+    static_assert(Arity >= 2, "a heap needs at least two children per node");
+    using T = std::iter_value_t<RandomIt>;
+
+    if (index == 0) {
+        return;
+    }
+
+    T value = std::move(data[index]);
+    while (index > 0) {
+        const size_t parent = (index - 1) / Arity;
+        if (!before(value, data[parent])) {
+            break;
+        }
+        data[index] = std::move(data[parent]);
+        track(data[index], index);
+        index = parent;
+    }
+    data[index] = std::move(value);
+    track(data[index], index);
+}
+
+// Bottom-up variant: the hole first descends along the best children all the way to a leaf,
+// then the held element climbs back from there (rarely more than a level or two)
+// Compared with stopping as soon as the element fits, this drops one comparison per level
+// and the hard-to-predict "stop here?" branch; the element being sifted down is usually
+// the former last leaf, so it would have travelled to the bottom anyway
+template <size_t Arity, std::random_access_iterator RandomIt, typename Before, typename Track = HeapNoTrack>
+void heap_sift_down(RandomIt data, size_t size, size_t index, Before before, Track track = Track()) {
+    static_assert(Arity >= 2, "a heap needs at least two children per node");
+    using T = std::iter_value_t<RandomIt>;
+
+    if (Arity * index + 1 >= size) {
+        return;
+    }
+
+    const size_t top = index;
+    T value = std::move(data[index]);
+    while (true) {
+        const size_t first = Arity * index + 1;
+        if (first >= size) {
+            break;
+        }
+
+        size_t best = first;
+        if (first + Arity <= size) {
+            // full group: the trip count is a constant, so the loop is unrolled
+            for (size_t k = 1; k < Arity; ++k) {
+                best = before(data[first + k], data[best]) ? first + k : best;
+            }
+        } else {
+            for (size_t child = first + 1; child < size; ++child) {
+                best = before(data[child], data[best]) ? child : best;
+            }
+        }
+
+        data[index] = std::move(data[best]);
+        track(data[index], index);
+        index = best;
+    }
+
+    while (index > top) {
+        const size_t parent = (index - 1) / Arity;
+        if (!before(value, data[parent])) {
+            break;
+        }
+        data[index] = std::move(data[parent]);
+        track(data[index], index);
+        index = parent;
+    }
+    data[index] = std::move(value);
+    track(data[index], index);
+}
+
+// Floyd's bottom-up construction, O(n)
+template <size_t Arity, std::random_access_iterator RandomIt, typename Before>
+void heap_make(RandomIt data, size_t size, Before before) {
+    if (size < 2) {
+        return;
+    }
+    for (size_t i = (size - 2) / Arity + 1; i > 0; --i) {
+        heap_sift_down<Arity>(data, size, i - 1, before);
+    }
+}
+
+// Allocator that puts element 1 (the first child of the root) at the start of a cache line
+// The children of every node then start at an offset that is a multiple of Arity * sizeof(T),
+// so they never straddle two lines when Arity * sizeof(T) divides the line size
+template <typename T>
+class HeapAllocator {
+  private:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t SHIFT = (CACHE_LINE - sizeof(T) % CACHE_LINE) % CACHE_LINE;
+
+    static_assert(alignof(T) <= CACHE_LINE, "over-aligned types are not supported");
+
+  public:
+    using value_type = T;
+
+    HeapAllocator() = default;
+
+    template <typename U>
+    HeapAllocator(const HeapAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        auto* raw = static_cast<std::byte*>(::operator new(n * sizeof(T) + SHIFT, std::align_val_t{CACHE_LINE}));
+        return reinterpret_cast<T*>(raw + SHIFT);
+    }
+
+    void deallocate(T* ptr, size_t) noexcept {
+        if (ptr != nullptr) {
+            ::operator delete(reinterpret_cast<std::byte*>(ptr) - SHIFT, std::align_val_t{CACHE_LINE});
+        }
+    }
+
+    template <typename U>
+    bool operator==(const HeapAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+}  // namespace ds::containers
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "HeapAlgorithms.hpp"
+#include "PriorityQueue.hpp"
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::containers {
+
+// Priority queue that hands out a stable handle for every pushed element
+// A position map (slot => heap index) makes update, erase and contains O(log n) / O(1)
+// instead of the linear search done by PriorityQueue::change_priority
+//
+// Ordering follows PriorityQueue: the element that compares greater is on top,
+// use std::greater<PriorityNode<T>> for a min-queue (Dijkstra, deadlines)
+template <typename T, typename Compare = std::less<PriorityNode<T>>, size_t Arity = 4>
+class IndexedPriorityQueue {
+  public:
+    // Stays valid until its element is popped or erased
+    // A freed slot is reused with a new generation, so stale handles are detected
+    class Handle {
+      private:
+        uint32_t slot_ = std::numeric_limits<uint32_t>::max();
+        uint32_t generation_ = 0;
+
+        friend class IndexedPriorityQueue;
+
+        Handle(uint32_t slot, uint32_t generation) : slot_(slot), generation_(generation) {}
+
+      public:
+        Handle() = default;
+
+        bool operator==(const Handle& other) const = default;
+    };
+
+  private:
+    static constexpr size_t NPOS = std::numeric_limits<size_t>::max();
+
+    struct Entry {
+        PriorityNode<T> node;
+        uint32_t slot;
+    };
+
+    struct Slot {
+        size_t position;  // index in heap_, NPOS while the slot is free
+        uint32_t generation;
+    };
+
+    DynamicArray<Entry, HeapAllocator<Entry>> heap_;
+    DynamicArray<Slot> slots_;
+    DynamicArray<uint32_t> free_slots_;
+    Compare comp_;
+
+    auto before() const {
+        return [this](const Entry& a, const Entry& b) { return comp_(b.node, a.node); };
+    }
+
+    auto track() {
+        return [this](const Entry& entry, size_t index) { slots_[entry.slot].position = index; };
+    }
+
+    void sift_up(size_t index) {
+        heap_sift_up<Arity>(heap_.begin(), index, before(), track());
+    }
+
+    void sift_down(size_t index) {
+        heap_sift_down<Arity>(heap_.begin(), heap_.size(), index, before(), track());
+    }
+
+    // Restores the heap around an element whose priority changed in either direction
+    void fix(size_t index) {
+        if (index > 0 && before()(heap_[index], heap_[(index - 1) / Arity])) {
+            sift_up(index);
+        } else {
+            sift_down(index);
+        }
+    }
+
+    size_t position_of(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("Invalid handle");
+        }
+        return slots_[handle.slot_].position;
+    }
+
+    uint32_t acquire_slot() {
+        if (!free_slots_.empty()) {
+            const uint32_t slot = free_slots_.back();
+            free_slots_.pop_back();
+            return slot;
+        }
+        slots_.push_back(Slot{NPOS, 0});
+        return static_cast<uint32_t>(slots_.size() - 1);
+    }
+
+    void release_slot(uint32_t slot) {
+        slots_[slot].position = NPOS;
+        ++slots_[slot].generation;
+        free_slots_.push_back(slot);
+    }
+
+    // Removes the entry at index, the last entry takes its place
+    void remove_at(size_t index) {
+        release_slot(heap_[index].slot);
+
+        const size_t last = heap_.size() - 1;
+        if (index != last) {
+            heap_[index] = std::move(heap_[last]);
+            slots_[heap_[index].slot].position = index;
+        }
+        heap_.pop_back();
+
+        if (index < heap_.size()) {
+            fix(index);
+        }
+    }
+
+  public:
+    using value_type = PriorityNode<T>;
+    using const_reference = const value_type&;
+    using size_type = size_t;
+
+    IndexedPriorityQueue() = default;
+
+    explicit IndexedPriorityQueue(const Compare& compare) : comp_(compare) {}
+
+    bool empty() const noexcept {
+        return heap_.empty();
+    }
+
+    size_type size() const noexcept {
+        return heap_.size();
+    }
+
+    void reserve(size_type new_cap) {
+        heap_.reserve(new_cap);
+        slots_.reserve(new_cap);
+    }
+
+    void clear() noexcept {
+        for (size_t i = 0; i < heap_.size(); ++i) {
+            slots_[heap_[i].slot].position = NPOS;
+            ++slots_[heap_[i].slot].generation;
+            free_slots_.push_back(heap_[i].slot);
+        }
+        heap_.clear();
+    }
+
+    // Element access
+
+    const_reference top() const {
+        if (empty()) {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        return heap_[0].node;
+    }
+
+    Handle top_handle() const {
+        if (empty()) {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        return Handle(heap_[0].slot, slots_[heap_[0].slot].generation);
+    }
+
+    bool contains(Handle handle) const noexcept {
+        return handle.slot_ < slots_.size() && slots_[handle.slot_].position != NPOS &&
+               slots_[handle.slot_].generation == handle.generation_;
+    }
+
+    long priority(Handle handle) const {
+        return heap_[position_of(handle)].node.priority;
+    }
+
+    const T& item(Handle handle) const {
+        return heap_[position_of(handle)].node.item;
+    }
+
+    // Modifiers
+
+    Handle push(const long priority, const T& item) {
+        return emplace(priority, item);
+    }
+
+    Handle push(const long priority, T&& item) {
+        return emplace(priority, std::move(item));
+    }
+
+    template <typename U>
+    Handle emplace(const long priority, U&& item) {
+        const uint32_t slot = acquire_slot();
+        heap_.push_back(Entry{value_type(priority, std::forward<U>(item)), slot});
+        slots_[slot].position = heap_.size() - 1;
+        sift_up(heap_.size() - 1);
+        return Handle(slot, slots_[slot].generation);
+    }
+
+    void pop() {
+        if (empty()) {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        remove_at(0);
+    }
+
+    T extract_min() {
+        if (empty()) {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        T result = std::move(heap_[0].node.item);
+        remove_at(0);
+        return result;
+    }
+
+    // Moves the element up or down depending on how its priority changed, O(log n)
+    void update(Handle handle, const long new_priority) {
+        const size_t index = position_of(handle);
+        heap_[index].node.priority = new_priority;
+        fix(index);
+    }
+
+    // Returns false if the handle no longer refers to an element
+    bool erase(Handle handle) {
+        if (!contains(handle)) {
+            return false;
+        }
+        remove_at(slots_[handle.slot_].position);
+        return true;
+    }
+};
+}  // namespace ds::containers
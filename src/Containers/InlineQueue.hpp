@@ -0,0 +1,208 @@
+#pragma once
+
+#include "InlineStorage.hpp"
+#include "Queue.hpp"
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ds::containers {
+
+// FIFO queue over a ring of N slots stored inside the object itself (no heap traffic up to N)
+// All operations are constexpr unless the Spill policy has to touch the heap
+//
+// Spill keeps FIFO order with a heap Queue behind the ring: once something has spilled,
+// new elements go to the overflow queue until the ring drains and the overflow is consumed
+template <typename T, size_t N, InlineOverflow Policy = InlineOverflow::Assert>
+class InlineQueue {
+  private:
+    static_assert(N > 0, "InlineQueue needs a non-zero capacity");
+
+    using SpillStorage = std::conditional_t<Policy == InlineOverflow::Spill, Queue<T>, NoSpill>;
+
+    InlineStorage<T, N> storage_;
+    size_t head_ = 0;  // slot of the front element
+    size_t size_ = 0;  // elements in the ring
+    [[no_unique_address]] SpillStorage spill_;
+
+    static constexpr size_t advance(size_t slot) noexcept {
+        return slot + 1 == N ? 0 : slot + 1;
+    }
+
+    constexpr size_t slot(size_t index) const noexcept {
+        const size_t pos = head_ + index;
+        return pos < N ? pos : pos - N;
+    }
+
+    constexpr bool spilled() const noexcept {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            return !spill_.empty();
+        } else {
+            return false;
+        }
+    }
+
+    template <typename Other>
+    constexpr void copy_ring_from(Other&& other) {
+        for (size_t i = 0; i < other.size_; ++i) {
+            if constexpr (std::is_rvalue_reference_v<Other&&>) {
+                storage_.construct(i, std::move(other.storage_.items[other.slot(i)]));
+            } else {
+                storage_.construct(i, other.storage_.items[other.slot(i)]);
+            }
+            ++size_;
+        }
+    }
+
+  public:
+    constexpr InlineQueue() = default;
+
+    constexpr InlineQueue(const InlineQueue& other) : spill_(other.spill_) {
+        copy_ring_from(other);
+    }
+
+    constexpr InlineQueue(InlineQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : spill_(std::move(other.spill_)) {
+        copy_ring_from(std::move(other));
+        other.clear();
+    }
+
+    constexpr InlineQueue& operator=(const InlineQueue& other) {
+        if (this != &other) {
+            clear();
+            spill_ = other.spill_;
+            copy_ring_from(other);
+        }
+        return *this;
+    }
+
+    constexpr InlineQueue& operator=(InlineQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            spill_ = std::move(other.spill_);
+            copy_ring_from(std::move(other));
+            other.clear();
+        }
+        return *this;
+    }
+
+    constexpr ~InlineQueue() {
+        clear();
+    }
+
+    // Returns false only with the Reject policy when the queue is full
+    template <typename... Args>
+    constexpr bool emplace(Args&&... args) {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            if (size_ == N || spilled()) {
+                spill_.emplace(std::forward<Args>(args)...);
+                return true;
+            }
+        } else if (size_ == N) {
+            if constexpr (Policy == InlineOverflow::Assert) {
+                assert(false && "InlineQueue overflow");
+            } else {
+                return false;
+            }
+        }
+
+        storage_.construct(slot(size_), std::forward<Args>(args)...);
+        ++size_;
+        return true;
+    }
+
+    constexpr bool enqueue(const T& item) {
+        return emplace(item);
+    }
+
+    constexpr bool enqueue(T&& item) {
+        return emplace(std::move(item));
+    }
+
+    constexpr void dequeue() {
+        if (size_ == 0) {
+            if constexpr (Policy == InlineOverflow::Spill) {
+                if (spilled()) {
+                    spill_.dequeue();
+                    return;
+                }
+            }
+            throw std::runtime_error("Queue is empty");
+        }
+
+        storage_.destroy(head_);
+        head_ = advance(head_);
+        --size_;
+    }
+
+    constexpr T& front() {
+        if (size_ == 0) {
+            if constexpr (Policy == InlineOverflow::Spill) {
+                if (spilled()) {
+                    return spill_.front();
+                }
+            }
+            throw std::runtime_error("Queue is empty");
+        }
+        return storage_.items[head_];
+    }
+
+    constexpr const T& front() const {
+        return const_cast<InlineQueue*>(this)->front();
+    }
+
+    constexpr T& back() {
+        if (spilled()) {
+            if constexpr (Policy == InlineOverflow::Spill) {
+                return spill_.back();
+            }
+        }
+        if (size_ == 0) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return storage_.items[slot(size_ - 1)];
+    }
+
+    constexpr const T& back() const {
+        return const_cast<InlineQueue*>(this)->back();
+    }
+
+    constexpr size_t size() const noexcept {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            return size_ + spill_.size();
+        } else {
+            return size_;
+        }
+    }
+
+    constexpr bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    constexpr bool full() const noexcept {
+        return Policy != InlineOverflow::Spill && size_ == N;
+    }
+
+    // True while part of the contents lives in the heap overflow queue
+    constexpr bool on_heap() const noexcept {
+        return spilled();
+    }
+
+    static constexpr size_t inline_capacity() noexcept {
+        return N;
+    }
+
+    constexpr void clear() noexcept {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            spill_.clear();
+        }
+        while (size_ > 0) {
+            storage_.destroy(head_);
+            head_ = advance(head_);
+            --size_;
+        }
+        head_ = 0;
+    }
+};
+}  // namespace ds::containers
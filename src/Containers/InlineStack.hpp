@@ -0,0 +1,194 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "InlineStorage.hpp"
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ds::containers {
+
+// Stack with room for N elements inside the object itself (no heap traffic up to N)
+// All operations are constexpr unless the Spill policy has to touch the heap
+template <typename T, size_t N, InlineOverflow Policy = InlineOverflow::Assert>
+class InlineStack {
+  private:
+    static_assert(N > 0, "InlineStack needs a non-zero capacity");
+
+    using SpillStorage = std::conditional_t<Policy == InlineOverflow::Spill, DynamicArray<T>, NoSpill>;
+
+    InlineStorage<T, N> storage_;
+    size_t size_ = 0;  // elements in the inline part
+    [[no_unique_address]] SpillStorage spill_;  // elements above the inline part
+
+    constexpr bool spilled() const noexcept {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            return !spill_.empty();
+        } else {
+            return false;
+        }
+    }
+
+  public:
+    constexpr InlineStack() = default;
+
+    constexpr InlineStack(const InlineStack& other) : spill_(other.spill_) {
+        for (; size_ < other.size_; ++size_) {
+            storage_.construct(size_, other.storage_.items[size_]);
+        }
+    }
+
+    constexpr InlineStack(InlineStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : spill_(std::move(other.spill_)) {
+        for (; size_ < other.size_; ++size_) {
+            storage_.construct(size_, std::move(other.storage_.items[size_]));
+        }
+        other.clear();
+    }
+
+    constexpr InlineStack& operator=(const InlineStack& other) {
+        if (this != &other) {
+            clear();
+            spill_ = other.spill_;
+            for (; size_ < other.size_; ++size_) {
+                storage_.construct(size_, other.storage_.items[size_]);
+            }
+        }
+        return *this;
+    }
+
+    constexpr InlineStack& operator=(InlineStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            spill_ = std::move(other.spill_);
+            for (; size_ < other.size_; ++size_) {
+                storage_.construct(size_, std::move(other.storage_.items[size_]));
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    constexpr ~InlineStack() {
+        clear();
+    }
+
+    // Returns false only with the Reject policy when the stack is full
+    template <typename... Args>
+    constexpr bool emplace(Args&&... args) {
+        if (size_ == N) {
+            if constexpr (Policy == InlineOverflow::Assert) {
+                assert(false && "InlineStack overflow");
+            } else if constexpr (Policy == InlineOverflow::Reject) {
+                return false;
+            } else {
+                spill_.emplace_back(std::forward<Args>(args)...);
+                return true;
+            }
+        }
+
+        storage_.construct(size_, std::forward<Args>(args)...);
+        ++size_;
+        return true;
+    }
+
+    constexpr bool push(const T& element) {
+        return emplace(element);
+    }
+
+    constexpr bool push(T&& element) {
+        return emplace(std::move(element));
+    }
+
+    constexpr void pop() {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        if constexpr (Policy == InlineOverflow::Spill) {
+            if (spilled()) {
+                spill_.pop_back();
+                return;
+            }
+        }
+        storage_.destroy(--size_);
+    }
+
+    constexpr T& top() {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        if constexpr (Policy == InlineOverflow::Spill) {
+            if (spilled()) {
+                return spill_.back();
+            }
+        }
+        return storage_.items[size_ - 1];
+    }
+
+    constexpr const T& top() const {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        if constexpr (Policy == InlineOverflow::Spill) {
+            if (spilled()) {
+                return spill_.back();
+            }
+        }
+        return storage_.items[size_ - 1];
+    }
+
+    // Element by position from the bottom
+    constexpr T& operator[](size_t index) {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            if (index >= N) {
+                return spill_[index - N];
+            }
+        }
+        return storage_.items[index];
+    }
+
+    constexpr const T& operator[](size_t index) const {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            if (index >= N) {
+                return spill_[index - N];
+            }
+        }
+        return storage_.items[index];
+    }
+
+    constexpr size_t size() const noexcept {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            return size_ + spill_.size();
+        } else {
+            return size_;
+        }
+    }
+
+    constexpr bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    constexpr bool full() const noexcept {
+        return Policy != InlineOverflow::Spill && size_ == N;
+    }
+
+    // True once the Spill policy had to allocate
+    constexpr bool on_heap() const noexcept {
+        return spilled();
+    }
+
+    static constexpr size_t inline_capacity() noexcept {
+        return N;
+    }
+
+    constexpr void clear() noexcept {
+        if constexpr (Policy == InlineOverflow::Spill) {
+            spill_.clear();
+        }
+        while (size_ > 0) {
+            storage_.destroy(--size_);
+        }
+    }
+};
+}  // namespace ds::containers
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace ds::containers {
+
+// What an inline container does when a push doesn't fit into its in-object storage
+enum class InlineOverflow {
+    Assert,  // the bound is a precondition: assert in debug builds, undefined behaviour otherwise
+    Reject,  // push returns false and leaves the container unchanged
+    Spill,   // the excess goes to a heap-allocated overflow container (not usable in constant expressions)
+};
+
+// Stand-in for the overflow container when the policy never spills
+struct NoSpill {};
+
+// Uninitialized in-object storage for N objects of type T
+// A union keeps the slots raw until they are constructed with std::construct_at,
+// which (unlike aligned byte buffers) also works in constant expressions
+template <typename T, size_t N>
+union InlineStorage {
+    T items[N];
+
+    constexpr InlineStorage() {}
+
+    constexpr ~InlineStorage() {}
+
+    template <typename... Args>
+    constexpr T* construct(size_t index, Args&&... args) {
+        return std::construct_at(items + index, std::forward<Args>(args)...);
+    }
+
+    constexpr void destroy(size_t index) {
+        std::destroy_at(items + index);
+    }
+};
+}  // namespace ds::containers
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::containers {
+
+// Tournament (loser) tree for merging k sorted runs
+//
+// Each internal node remembers the run that lost the match played there, the overall winner
+// is kept apart. After the winner's element is taken only its leaf changes, so the next winner
+// is found by replaying the matches on the path to the root: exactly log2(k) comparisons per
+// element and no sibling lookups, against ~2 log2(k) for a heap of run heads
+//
+// The merge is stable: equal elements come out in run order, then in their order inside a run
+// The runs are only referenced, they must outlive the tree
+template <typename T, typename Compare = std::less<T>>
+class LoserTree {
+  public:
+    struct Run {
+        const T* first;
+        const T* last;
+    };
+
+  private:
+    DynamicArray<Run> runs_;      // padded with empty runs to a power of two
+    DynamicArray<size_t> tree_;   // tree_[0] is the winner, tree_[1...] the losers
+    size_t remaining_ = 0;
+    Compare comp_;
+
+    // True if run a's head goes out before run b's, exhausted runs lose to everything
+    bool beats(size_t a, size_t b) const {
+        if (runs_[a].first == runs_[a].last) {
+            return false;
+        }
+        if (runs_[b].first == runs_[b].last) {
+            return true;
+        }
+        if (comp_(*runs_[b].first, *runs_[a].first)) {
+            return false;
+        }
+        return comp_(*runs_[a].first, *runs_[b].first) || a < b;
+    }
+
+    void build() {
+        const size_t leaves = runs_.size();
+        DynamicArray<size_t> winners(2 * leaves);
+        for (size_t i = 0; i < leaves; ++i) {
+            winners[leaves + i] = i;
+        }
+
+        tree_ = DynamicArray<size_t>(leaves);
+        for (size_t node = leaves - 1; node > 0; --node) {
+            const size_t left = winners[2 * node];
+            const size_t right = winners[2 * node + 1];
+            const bool left_wins = beats(left, right);
+            winners[node] = left_wins ? left : right;
+            tree_[node] = left_wins ? right : left;
+        }
+        tree_[0] = winners[1];
+    }
+
+    // Replays the path of the run whose head was just taken
+    void replay(size_t winner) {
+        for (size_t node = (winner + runs_.size()) / 2; node > 0; node /= 2) {
+            if (beats(tree_[node], winner)) {
+                std::swap(tree_[node], winner);
+            }
+        }
+        tree_[0] = winner;
+    }
+
+  public:
+    explicit LoserTree(const DynamicArray<Run>& runs, const Compare& compare = Compare()) : comp_(compare) {
+        const size_t leaves = std::bit_ceil(runs.empty() ? size_t{1} : runs.size());
+        runs_.reserve(leaves);
+        for (size_t i = 0; i < runs.size(); ++i) {
+            runs_.push_back(runs[i]);
+            remaining_ += static_cast<size_t>(runs[i].last - runs[i].first);
+        }
+        while (runs_.size() < leaves) {
+            runs_.push_back(Run{nullptr, nullptr});
+        }
+        build();
+    }
+
+    explicit LoserTree(const DynamicArray<DynamicArray<T>>& runs, const Compare& compare = Compare())
+        : LoserTree(as_runs(runs), compare) {}
+
+    static DynamicArray<Run> as_runs(const DynamicArray<DynamicArray<T>>& runs) {
+        DynamicArray<Run> result;
+        result.reserve(runs.size());
+        for (size_t i = 0; i < runs.size(); ++i) {
+            result.push_back(Run{runs[i].cbegin(), runs[i].cbegin() + runs[i].size()});
+        }
+        return result;
+    }
+
+    bool empty() const noexcept {
+        return remaining_ == 0;
+    }
+
+    // Elements not merged yet
+    size_t size() const noexcept {
+        return remaining_;
+    }
+
+    const T& top() const {
+        if (empty()) {
+            throw std::runtime_error("LoserTree is empty");
+        }
+        return *runs_[tree_[0]].first;
+    }
+
+    void pop() {
+        if (empty()) {
+            throw std::runtime_error("LoserTree is empty");
+        }
+        const size_t winner = tree_[0];
+        ++runs_[winner].first;
+        --remaining_;
+        replay(winner);
+    }
+
+    // Copies up to count next elements to out and returns how many were written
+    // Tight loop without the per-element empty checks of top() / pop()
+    size_t next_batch(T* out, size_t count) {
+        count = count < remaining_ ? count : remaining_;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t winner = tree_[0];
+            out[i] = *runs_[winner].first++;
+            replay(winner);
+        }
+        remaining_ -= count;
+        return count;
+    }
+
+    // Merges everything that is left
+    DynamicArray<T> drain() {
+        DynamicArray<T> result(remaining_);
+        next_batch(result.begin(), result.size());
+        return result;
+    }
+};
+
+// Stable k-way merge of sorted runs
+template <typename T, typename Compare = std::less<T>>
+DynamicArray<T> merge_runs(const DynamicArray<DynamicArray<T>>& runs, const Compare& compare = Compare()) {
+    return LoserTree<T, Compare>(runs, compare).drain();
+}
+}  // namespace ds::containers
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::containers {
+
+// Double-ended priority queue (min-max heap, Atkinson et al. 1986) over a DynamicArray
+// Binary heap whose even levels are ordered like a min-heap and odd levels like a max-heap:
+// the minimum is the root and the maximum is one of its two children
+//
+// min() / max() are O(1), push / pop_min / pop_max are O(log n), the bulk constructor is O(n)
+// One array holds every element once, where a pair of heaps would store (and update) both
+template <typename T, typename Compare = std::less<T>>
+class MinMaxHeap {
+  private:
+    DynamicArray<T> data_;
+    Compare comp_;
+
+    static bool on_min_level(size_t index) noexcept {
+        return (std::bit_width(index + 1) & 1) == 1;
+    }
+
+    // before<true> orders like a min-heap, before<false> like a max-heap
+    template <bool Min>
+    bool before(const T& a, const T& b) const {
+        return Min ? comp_(a, b) : comp_(b, a);
+    }
+
+    // Moves the element at index up through the grandparents on its own kind of level
+    template <bool Min>
+    void bubble_up_grandparents(size_t index) {
+        if (index < 3) {
+            return;
+        }
+        T value = std::move(data_[index]);
+        while (index >= 3) {
+            const size_t grandparent = (index - 3) / 4;
+            if (!before<Min>(value, data_[grandparent])) {
+                break;
+            }
+            data_[index] = std::move(data_[grandparent]);
+            index = grandparent;
+        }
+        data_[index] = std::move(value);
+    }
+
+    void bubble_up(size_t index) {
+        if (index == 0) {
+            return;
+        }
+        const size_t parent = (index - 1) / 2;
+        if (on_min_level(index)) {
+            if (before<false>(data_[index], data_[parent])) {
+                std::swap(data_[index], data_[parent]);
+                bubble_up_grandparents<false>(parent);
+            } else {
+                bubble_up_grandparents<true>(index);
+            }
+        } else {
+            if (before<true>(data_[index], data_[parent])) {
+                std::swap(data_[index], data_[parent]);
+                bubble_up_grandparents<true>(parent);
+            } else {
+                bubble_up_grandparents<false>(index);
+            }
+        }
+    }
+
+    // Sinks the element at index, comparing it with its children and grandchildren
+    template <bool Min>
+    void trickle_down(size_t index) {
+        const size_t size = data_.size();
+        while (true) {
+            const size_t child = 2 * index + 1;
+            if (child >= size) {
+                return;
+            }
+
+            size_t best = child;
+            if (child + 1 < size && before<Min>(data_[child + 1], data_[best])) {
+                best = child + 1;
+            }
+            const size_t grandchild = 4 * index + 3;
+            for (size_t i = grandchild; i < grandchild + 4 && i < size; ++i) {
+                if (before<Min>(data_[i], data_[best])) {
+                    best = i;
+                }
+            }
+
+            if (!before<Min>(data_[best], data_[index])) {
+                return;
+            }
+            std::swap(data_[best], data_[index]);
+            if (best < grandchild) {
+                return;  // the best was a child, so nothing below it beats the element that took its place
+            }
+
+            const size_t parent = (best - 1) / 2;
+            if (before<Min>(data_[parent], data_[best])) {
+                std::swap(data_[parent], data_[best]);
+            }
+            index = best;
+        }
+    }
+
+    void trickle_down(size_t index) {
+        if (on_min_level(index)) {
+            trickle_down<true>(index);
+        } else {
+            trickle_down<false>(index);
+        }
+    }
+
+    size_t max_index() const noexcept {
+        if (data_.size() < 3) {
+            return data_.size() - 1;
+        }
+        return before<false>(data_[2], data_[1]) ? 2 : 1;
+    }
+
+    // Replaces the element at index with the last one and restores the order below it
+    void remove_at(size_t index) {
+        const size_t last = data_.size() - 1;
+        if (index != last) {
+            data_[index] = std::move(data_[last]);
+        }
+        data_.pop_back();
+        if (index < data_.size()) {
+            trickle_down(index);
+        }
+    }
+
+    void make_heap() {
+        for (size_t i = data_.size() / 2; i > 0; --i) {
+            trickle_down(i - 1);
+        }
+    }
+
+  public:
+    MinMaxHeap() = default;
+
+    explicit MinMaxHeap(const Compare& compare) : comp_(compare) {}
+
+    // Bulk construction, O(n) instead of n pushes
+    explicit MinMaxHeap(DynamicArray<T> elements, const Compare& compare = Compare()) : data_(std::move(elements)), comp_(compare) {
+        make_heap();
+    }
+
+    template <typename InputIt>
+    MinMaxHeap(InputIt first, InputIt last, const Compare& compare = Compare()) : comp_(compare) {
+        for (; first != last; ++first) {
+            data_.push_back(*first);
+        }
+        make_heap();
+    }
+
+    bool empty() const noexcept {
+        return data_.empty();
+    }
+
+    size_t size() const noexcept {
+        return data_.size();
+    }
+
+    void reserve(size_t new_cap) {
+        data_.reserve(new_cap);
+    }
+
+    void clear() noexcept {
+        data_.clear();
+    }
+
+    const T& min() const {
+        if (empty()) {
+            throw std::runtime_error("Heap is empty");
+        }
+        return data_[0];
+    }
+
+    const T& max() const {
+        if (empty()) {
+            throw std::runtime_error("Heap is empty");
+        }
+        return data_[max_index()];
+    }
+
+    void push(const T& item) {
+        data_.push_back(item);
+        bubble_up(data_.size() - 1);
+    }
+
+    void push(T&& item) {
+        data_.push_back(std::move(item));
+        bubble_up(data_.size() - 1);
+    }
+
+    void pop_min() {
+        if (empty()) {
+            throw std::runtime_error("Heap is empty");
+        }
+        remove_at(0);
+    }
+
+    void pop_max() {
+        if (empty()) {
+            throw std::runtime_error("Heap is empty");
+        }
+        remove_at(max_index());
+    }
+
+    T extract_min() {
+        if (empty()) {
+            throw std::runtime_error("Heap is empty");
+        }
+        T result = std::move(data_[0]);
+        remove_at(0);
+        return result;
+    }
+
+    T extract_max() {
+        if (empty()) {
+            throw std::runtime_error("Heap is empty");
+        }
+        const size_t index = max_index();
+        T result = std::move(data_[index]);
+        remove_at(index);
+        return result;
+    }
+};
+}  // namespace ds::containers
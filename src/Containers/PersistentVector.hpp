@@ -0,0 +1,409 @@
+#pragma once
+
+#include "../SmartPtrs/SharedPtr.hpp"
+#include "DynamicArray.hpp"
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::containers {
+
+// Immutable vector with structural sharing (32-way radix-balanced tree + tail buffer)
+//
+// Copying a vector is O(1) and gives an independent snapshot. Every "modification" returns
+// a new vector that shares all untouched nodes with the old one, so an update allocates
+// only the O(log32 n) nodes on the path from the root to the changed leaf
+//
+// Transient is the batch-edit mode: it mutates nodes in place as long as nobody else
+// references them (use_count() == 1) and falls back to copy-on-write otherwise,
+// so taking a snapshot from it in the middle of a batch is always safe
+template <typename T>
+class PersistentVector {
+  private:
+    static constexpr size_t BITS = 5;
+    static constexpr size_t BRANCHING = size_t{1} << BITS;
+    static constexpr size_t MASK = BRANCHING - 1;
+
+    struct Node;
+    using NodePtr = smart_ptrs::SharedPtr<Node>;
+
+    // Inner nodes use children, leaves use values
+    struct Node {
+        DynamicArray<NodePtr> children;
+        DynamicArray<T> values;
+    };
+
+    NodePtr root_;  // null while all elements fit in the tail
+    NodePtr tail_;  // last (possibly partial) leaf, null when empty
+    size_t size_ = 0;
+    size_t shift_ = BITS;
+
+    static NodePtr make_node() {
+        return smart_ptrs::make_shared<Node>();
+    }
+
+    // In transient mode a node referenced only by us can be edited in place, otherwise it's copied
+    static NodePtr editable(const NodePtr& node, bool transient) {
+        if (transient && node.use_count() == 1) {
+            return node;
+        }
+        return smart_ptrs::make_shared<Node>(*node);
+    }
+
+    size_t tail_offset() const noexcept {
+        return size_ < BRANCHING ? 0 : ((size_ - 1) >> BITS) << BITS;
+    }
+
+    const Node* leaf_for(size_t index) const {
+        if (index >= tail_offset()) {
+            return tail_.get();
+        }
+
+        const Node* node = root_.get();
+        for (size_t level = shift_; level > 0; level -= BITS) {
+            node = node->children[(index >> level) & MASK].get();
+        }
+        return node;
+    }
+
+    static NodePtr new_path(size_t level, const NodePtr& leaf) {
+        if (level == 0) {
+            return leaf;
+        }
+        NodePtr node = make_node();
+        node->children.push_back(new_path(level - BITS, leaf));
+        return node;
+    }
+
+    NodePtr push_tail(size_t level, const NodePtr& parent, const NodePtr& leaf, bool transient) const {
+        const size_t sub_index = ((size_ - 1) >> level) & MASK;
+        NodePtr result = editable(parent, transient);
+
+        NodePtr to_insert;
+        if (level == BITS) {
+            to_insert = leaf;
+        } else if (sub_index < parent->children.size()) {
+            to_insert = push_tail(level - BITS, parent->children[sub_index], leaf, transient);
+        } else {
+            to_insert = new_path(level - BITS, leaf);
+        }
+
+        if (sub_index < result->children.size()) {
+            result->children[sub_index] = std::move(to_insert);
+        } else {
+            result->children.push_back(std::move(to_insert));
+        }
+        return result;
+    }
+
+    NodePtr pop_tail(size_t level, const NodePtr& node, bool transient) const {
+        const size_t sub_index = ((size_ - 2) >> level) & MASK;
+
+        if (level > BITS) {
+            NodePtr new_child = pop_tail(level - BITS, node->children[sub_index], transient);
+            if (!new_child && sub_index == 0) {
+                return NodePtr();
+            }
+
+            NodePtr result = editable(node, transient);
+            if (new_child) {
+                result->children[sub_index] = std::move(new_child);
+            } else {
+                result->children.pop_back();
+            }
+            return result;
+        }
+
+        if (sub_index == 0) {
+            return NodePtr();
+        }
+        NodePtr result = editable(node, transient);
+        result->children.pop_back();
+        return result;
+    }
+
+    NodePtr set_in(size_t level, const NodePtr& node, size_t index, T&& value, bool transient) const {
+        NodePtr result = editable(node, transient);
+        if (level == 0) {
+            result->values[index & MASK] = std::move(value);
+        } else {
+            const size_t sub_index = (index >> level) & MASK;
+            result->children[sub_index] = set_in(level - BITS, node->children[sub_index], index, std::move(value), transient);
+        }
+        return result;
+    }
+
+    void push_back_impl(T value, bool transient) {
+        if (size_ - tail_offset() < BRANCHING) {
+            // room left in the tail
+            tail_ = tail_ ? editable(tail_, transient) : make_node();
+            tail_->values.push_back(std::move(value));
+            ++size_;
+            return;
+        }
+
+        // the tail is full => push it into the tree
+        if (!root_) {
+            root_ = make_node();
+            root_->children.push_back(tail_);
+        } else if ((size_ >> BITS) > (size_t{1} << shift_)) {
+            // root overflow => grow the tree by one level
+            NodePtr new_root = make_node();
+            new_root->children.push_back(root_);
+            new_root->children.push_back(new_path(shift_, tail_));
+            root_ = std::move(new_root);
+            shift_ += BITS;
+        } else {
+            root_ = push_tail(shift_, root_, tail_, transient);
+        }
+
+        tail_ = make_node();
+        tail_->values.reserve(BRANCHING);
+        tail_->values.push_back(std::move(value));
+        ++size_;
+    }
+
+    void set_impl(size_t index, T value, bool transient) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        if (index >= tail_offset()) {
+            tail_ = editable(tail_, transient);
+            tail_->values[index & MASK] = std::move(value);
+        } else {
+            root_ = set_in(shift_, root_, index, std::move(value), transient);
+        }
+    }
+
+    void pop_back_impl(bool transient) {
+        if (size_ == 0) {
+            throw std::runtime_error("PersistentVector is empty");
+        }
+
+        if (size_ == 1) {
+            root_ = NodePtr();
+            tail_ = NodePtr();
+            size_ = 0;
+            shift_ = BITS;
+            return;
+        }
+
+        if (size_ - tail_offset() > 1) {
+            tail_ = editable(tail_, transient);
+            tail_->values.pop_back();
+            --size_;
+            return;
+        }
+
+        // the tail becomes empty => the last leaf of the tree becomes the new tail
+        NodePtr new_tail = leaf_ptr_for(size_ - 2);
+        NodePtr new_root = pop_tail(shift_, root_, transient);
+
+        if (new_root && shift_ > BITS && new_root->children.size() == 1) {
+            new_root = new_root->children[0];
+            shift_ -= BITS;
+        }
+        if (new_root && new_root->children.empty()) {
+            new_root = NodePtr();
+        }
+
+        root_ = std::move(new_root);
+        tail_ = std::move(new_tail);
+        --size_;
+        if (!root_) {
+            shift_ = BITS;
+        }
+    }
+
+    NodePtr leaf_ptr_for(size_t index) const {
+        NodePtr node = root_;
+        for (size_t level = shift_; level > 0; level -= BITS) {
+            node = node->children[(index >> level) & MASK];
+        }
+        return node;
+    }
+
+  public:
+    class Transient;
+
+    class const_iterator {
+      private:
+        const PersistentVector* vec_;
+        size_t index_;
+        const T* leaf_;  // values of the leaf holding index_, refreshed every 32 elements
+
+        void load_leaf() {
+            leaf_ = index_ < vec_->size_ ? vec_->leaf_for(index_)->values.cbegin() : nullptr;
+        }
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : vec_(nullptr), index_(0), leaf_(nullptr) {}
+
+        const_iterator(const PersistentVector* vec, size_t index) : vec_(vec), index_(index) {
+            load_leaf();
+        }
+
+        reference operator*() const {
+            return leaf_[index_ & MASK];
+        }
+
+        pointer operator->() const {
+            return leaf_ + (index_ & MASK);
+        }
+
+        const_iterator& operator++() {
+            ++index_;
+            if ((index_ & MASK) == 0) {
+                load_leaf();
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return index_ == other.index_;
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return index_ != other.index_;
+        }
+    };
+
+    using value_type = T;
+    using const_reference = const T&;
+    using iterator = const_iterator;
+
+    PersistentVector() = default;
+
+    PersistentVector(std::initializer_list<T> init) {
+        for (const auto& item : init) {
+            push_back_impl(item, true);
+        }
+    }
+
+    template <typename InputIt>
+    PersistentVector(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            push_back_impl(*first, true);
+        }
+    }
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    const T& operator[](size_t index) const {
+        return leaf_for(index)->values[index & MASK];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    const T& front() const {
+        return at(0);
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::out_of_range("Index out of range");
+        }
+        return tail_->values.back();
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, size_);
+    }
+
+    // Each of these leaves *this untouched and returns the updated version
+
+    [[nodiscard]] PersistentVector push_back(T value) const {
+        PersistentVector result(*this);
+        result.push_back_impl(std::move(value), false);
+        return result;
+    }
+
+    [[nodiscard]] PersistentVector set(size_t index, T value) const {
+        PersistentVector result(*this);
+        result.set_impl(index, std::move(value), false);
+        return result;
+    }
+
+    [[nodiscard]] PersistentVector pop_back() const {
+        PersistentVector result(*this);
+        result.pop_back_impl(false);
+        return result;
+    }
+
+    // Starts a batch edit on top of this version
+    Transient transient() const {
+        return Transient(*this);
+    }
+
+    class Transient {
+      private:
+        PersistentVector vec_;
+
+        friend class PersistentVector;
+
+        explicit Transient(const PersistentVector& vec) : vec_(vec) {}
+
+      public:
+        Transient() = default;
+
+        size_t size() const noexcept {
+            return vec_.size();
+        }
+
+        bool empty() const noexcept {
+            return vec_.empty();
+        }
+
+        const T& operator[](size_t index) const {
+            return vec_[index];
+        }
+
+        void push_back(T value) {
+            vec_.push_back_impl(std::move(value), true);
+        }
+
+        void set(size_t index, T value) {
+            vec_.set_impl(index, std::move(value), true);
+        }
+
+        void pop_back() {
+            vec_.pop_back_impl(true);
+        }
+
+        // O(1) snapshot of the current state, the transient stays usable afterwards
+        PersistentVector persistent() const {
+            return vec_;
+        }
+    };
+};
+}  // namespace ds::containers
@@ -1,5 +1,6 @@
 #pragma once
 #include "DynamicArray.hpp"
+#include "HeapAlgorithms.hpp"
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -27,41 +28,35 @@ class PriorityNode {
     bool operator==(const PriorityNode& other) const { return priority == other.priority; }
 };
 
-template <typename T, typename Container = DynamicArray<PriorityNode<T>>,
-          typename Compare = std::less<PriorityNode<T>>>
+// Container needs random-access iterators (DynamicArray, std::vector, std::deque)
+// Arity is the number of children per node, 4 or 8 trade a few more comparisons per level
+// for a much shallower heap (the default container keeps the children in one cache line)
+// Arity comes last to keep existing PriorityQueue<T, Container, Compare> spellings valid,
+// so picking an arity means spelling out Compare too
+template <typename T, typename Container = DynamicArray<PriorityNode<T>, HeapAllocator<PriorityNode<T>>>,
+          typename Compare = std::less<PriorityNode<T>>, size_t Arity = 2>
 class PriorityQueue {
+    static_assert(std::random_access_iterator<typename Container::iterator>, "PriorityQueue needs a random-access container");
+
   private:
     Container c;
     Compare comp;
 
+    // the element that compares greater is closer to the top
+    auto before() const {
+        return [this](const PriorityNode<T>& a, const PriorityNode<T>& b) { return comp(b, a); };
+    }
+
     void heapify_up(size_t index) {
-        while (index > 0) {
-            size_t parent = (index - 1) / 2;
-            if (!comp(c[parent], c[index]))
-                break;
-            std::swap(c[index], c[parent]);
-            index = parent;
-        }
+        heap_sift_up<Arity>(c.begin(), index, before());
     }
 
     void heapify_down(size_t index) {
-        size_t size = c.size();
-        while (true) {
-            size_t largest = index;
-            size_t left = 2 * index + 1;
-            size_t right = 2 * index + 2;
-
-            if (left < size && comp(c[largest], c[left]))
-                largest = left;
-            if (right < size && comp(c[largest], c[right]))
-                largest = right;
-
-            if (largest == index)
-                break;
-
-            std::swap(c[index], c[largest]);
-            index = largest;
-        }
+        heap_sift_down<Arity>(c.begin(), c.size(), index, before());
+    }
+
+    void make_heap() {
+        heap_make<Arity>(c.begin(), c.size(), before());
     }
 
   public:
@@ -92,9 +87,7 @@ class PriorityQueue {
         for (const auto& item : init) {
             c.push_back(item);
         }
-        for (int i = (c.size() / 2) - 1; i >= 0; --i) {
-            heapify_down(i);
-        }
+        make_heap();
     }
 
     void swap(PriorityQueue& other) noexcept(std::is_nothrow_swappable_v<Container> && std::is_nothrow_swappable_v<Compare>) {
@@ -141,7 +134,8 @@ class PriorityQueue {
     void pop() {
         if (empty())
             throw std::runtime_error("Priority queue is empty");
-        c[0] = std::move(c.back());
+        if (c.size() > 1)
+            c[0] = std::move(c.back());
         c.pop_back();
         if (!empty())
             heapify_down(0);
@@ -180,9 +174,7 @@ class PriorityQueue {
             c.push_back(std::move(elem));
         }
 
-        for (int i = (c.size() / 2) - 1; i >= 0; --i) {
-            heapify_down(i);
-        }
+        make_heap();
 
         other.clear();
     }
@@ -1,127 +1,362 @@
 #pragma once
 
-#include "Stack.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace ds::containers {
 
-template <typename T>
+// Double-ended queue over a contiguous ring buffer
+// Capacity is always a power of two, so physical positions are computed with a mask
+// Every operation is O(1) (amortized for pushes), elements are moved only when the buffer grows
+template <typename T, typename Allocator = std::allocator<T>>
 class Queue {
   private:
-    Stack<T> input_stack;
-    Stack<T> output_stack;
-
-    void transfer_elements() {
-        if (output_stack.empty()) {
-            while (!input_stack.empty()) {
-                output_stack.push(std::move(input_stack.top()));
-                input_stack.pop();
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    static constexpr size_t MIN_CAPACITY = 8;
+
+    T* buffer_ = nullptr;
+    size_t capacity_ = 0;  // 0 or a power of two
+    size_t head_ = 0;      // physical index of the front element
+    size_t size_ = 0;
+    Allocator allocator_;
+
+    size_t mask() const noexcept {
+        return capacity_ - 1;
+    }
+
+    T* slot(size_t logical_index) const noexcept {
+        return buffer_ + ((head_ + logical_index) & mask());
+    }
+
+    size_t grown_capacity(size_t min_capacity) const noexcept {
+        return std::bit_ceil(std::max(min_capacity, MIN_CAPACITY));
+    }
+
+    // Moves (or copies, when moving may throw) the elements into new_buffer unrolled from index 0
+    // The old slots stay alive, if a move or copy throws the ones already made are destroyed again
+    void transfer_to(T* new_buffer) {
+        // the live range is at most two segments: [head_, capacity_) and [0, wrapped)
+        const size_t first_part = std::min(size_, capacity_ - head_);
+        const size_t wrapped = size_ - first_part;
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (first_part != 0) {
+                std::memcpy(static_cast<void*>(new_buffer), static_cast<const void*>(buffer_ + head_), first_part * sizeof(T));
+            }
+            if (wrapped != 0) {
+                std::memcpy(static_cast<void*>(new_buffer + first_part), static_cast<const void*>(buffer_), wrapped * sizeof(T));
+            }
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < size_; ++i) {
+                    AllocTraits::construct(allocator_, new_buffer + i, std::move_if_noexcept(*slot(i)));
+                }
+            } catch (...) {
+                for (size_t j = 0; j < i; ++j) {
+                    AllocTraits::destroy(allocator_, new_buffer + j);
+                }
+                throw;
             }
         }
     }
 
+    // Switches to a buffer filled by transfer_to, destroying the old elements
+    void adopt(T* new_buffer, size_t new_capacity) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < size_; ++i) {
+                AllocTraits::destroy(allocator_, slot(i));
+            }
+        }
+        if (buffer_ != nullptr) {
+            AllocTraits::deallocate(allocator_, buffer_, capacity_);
+        }
+        buffer_ = new_buffer;
+        capacity_ = new_capacity;
+        head_ = 0;
+    }
+
+    // Moves the elements into a new buffer unrolled from index 0, nothing changes if it throws
+    void grow(size_t min_capacity) {
+        const size_t new_capacity = grown_capacity(min_capacity);
+        if (new_capacity <= capacity_) {
+            return;
+        }
+
+        T* new_buffer = AllocTraits::allocate(allocator_, new_capacity);
+        try {
+            transfer_to(new_buffer);
+        } catch (...) {
+            AllocTraits::deallocate(allocator_, new_buffer, new_capacity);
+            throw;
+        }
+        adopt(new_buffer, new_capacity);
+    }
+
+    // Doubles the full buffer with a new element at the back (or at the front), without changing size_
+    // The element is constructed before the old ones move, so args may refer to them
+    template <typename... Args>
+    void grow_emplace(bool at_front, Args&&... args) {
+        const size_t new_capacity = grown_capacity(capacity_ * 2);
+        const size_t index = at_front ? new_capacity - 1 : size_;
+
+        T* new_buffer = AllocTraits::allocate(allocator_, new_capacity);
+        try {
+            AllocTraits::construct(allocator_, new_buffer + index, std::forward<Args>(args)...);
+        } catch (...) {
+            AllocTraits::deallocate(allocator_, new_buffer, new_capacity);
+            throw;
+        }
+        try {
+            transfer_to(new_buffer);
+        } catch (...) {
+            AllocTraits::destroy(allocator_, new_buffer + index);
+            AllocTraits::deallocate(allocator_, new_buffer, new_capacity);
+            throw;
+        }
+        adopt(new_buffer, new_capacity);
+        if (at_front) {
+            head_ = index;
+        }
+    }
+
+    void check_not_empty() const {
+        if (size_ == 0) {
+            throw std::runtime_error("Queue is empty");
+        }
+    }
+
+    void release() noexcept {
+        clear();
+        if (buffer_ != nullptr) {
+            AllocTraits::deallocate(allocator_, buffer_, capacity_);
+        }
+        buffer_ = nullptr;
+        capacity_ = 0;
+    }
+
   public:
     Queue() = default;
-    ~Queue() = default;
 
-    Queue(const Queue& other) : input_stack(other.input_stack), output_stack(other.output_stack) {}
+    ~Queue() {
+        release();
+    }
+
+    Queue(const Queue& other) : allocator_(AllocTraits::select_on_container_copy_construction(other.allocator_)) {
+        reserve(other.size_);
+        for (size_t i = 0; i < other.size_; ++i) {
+            push_back(*other.slot(i));
+        }
+    }
 
     Queue(Queue&& other) noexcept
-        : input_stack(std::move(other.input_stack)), output_stack(std::move(other.output_stack)) {}
+        : buffer_(std::exchange(other.buffer_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          head_(std::exchange(other.head_, 0)),
+          size_(std::exchange(other.size_, 0)),
+          allocator_(std::move(other.allocator_)) {}
 
     Queue& operator=(const Queue& other) {
         if (this != &other) {
-            input_stack = other.input_stack;
-            output_stack = other.output_stack;
+            Queue(other).swap(*this);
         }
         return *this;
     }
 
     Queue& operator=(Queue&& other) noexcept {
         if (this != &other) {
-            input_stack = std::move(other.input_stack);
-            output_stack = std::move(other.output_stack);
+            release();
+            buffer_ = std::exchange(other.buffer_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            head_ = std::exchange(other.head_, 0);
+            size_ = std::exchange(other.size_, 0);
+            allocator_ = std::move(other.allocator_);
         }
         return *this;
     }
 
+    // Back
+
+    // args may refer to elements of the queue, even when it has to grow
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            grow_emplace(false, std::forward<Args>(args)...);
+        } else {
+            AllocTraits::construct(allocator_, slot(size_), std::forward<Args>(args)...);
+        }
+        ++size_;
+        return *slot(size_ - 1);
+    }
+
+    void push_back(const T& item) {
+        emplace_back(item);
+    }
+
+    void push_back(T&& item) {
+        emplace_back(std::move(item));
+    }
+
+    void pop_back() {
+        check_not_empty();
+        AllocTraits::destroy(allocator_, slot(size_ - 1));
+        --size_;
+    }
+
+    T& back() {
+        check_not_empty();
+        return *slot(size_ - 1);
+    }
+
+    const T& back() const {
+        check_not_empty();
+        return *slot(size_ - 1);
+    }
+
+    // Front
+
+    // args may refer to elements of the queue, even when it has to grow
+    template <typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (size_ == capacity_) {
+            grow_emplace(true, std::forward<Args>(args)...);
+        } else {
+            const size_t new_head = (head_ - 1) & mask();
+            AllocTraits::construct(allocator_, buffer_ + new_head, std::forward<Args>(args)...);
+            head_ = new_head;
+        }
+        ++size_;
+        return buffer_[head_];
+    }
+
+    void push_front(const T& item) {
+        emplace_front(item);
+    }
+
+    void push_front(T&& item) {
+        emplace_front(std::move(item));
+    }
+
+    void pop_front() {
+        check_not_empty();
+        AllocTraits::destroy(allocator_, buffer_ + head_);
+        head_ = (head_ + 1) & mask();
+        --size_;
+    }
+
+    T& front() {
+        check_not_empty();
+        return buffer_[head_];
+    }
+
+    const T& front() const {
+        check_not_empty();
+        return buffer_[head_];
+    }
+
+    // FIFO interface
+
     void enqueue(const T& item) {
-        input_stack.push(item);
+        push_back(item);
     }
 
     void enqueue(T&& item) {
-        input_stack.push(std::move(item));
+        push_back(std::move(item));
     }
 
     template <typename... Args>
     void emplace(Args&&... args) {
-        input_stack.emplace(std::forward<Args>(args)...);
+        emplace_back(std::forward<Args>(args)...);
     }
 
     void dequeue() {
-        if (empty()) {
-            throw std::runtime_error("Queue is empty");
+        pop_front();
+    }
+
+    // Element access by position from the front
+
+    T& operator[](size_t index) {
+        return *slot(index);
+    }
+
+    const T& operator[](size_t index) const {
+        return *slot(index);
+    }
+
+    T& at(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
         }
-        transfer_elements();
-        output_stack.pop();
+        return *slot(index);
     }
 
-    const T front() {
-        if (empty()) {
-            throw std::runtime_error("Queue is empty");
+    const T& at(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
         }
-        transfer_elements();
-        return output_stack.top();
+        return *slot(index);
     }
 
+    // Capacity
+
     size_t size() const noexcept {
-        return input_stack.size() + output_stack.size();
+        return size_;
     }
 
     bool empty() const noexcept {
-        return input_stack.empty() && output_stack.empty();
+        return size_ == 0;
     }
 
-    Queue reverse() const {
-        Queue reversed;
-        Stack<T> temp = output_stack;
+    size_t capacity() const noexcept {
+        return capacity_;
+    }
 
-        for (Stack<T> in_temp = input_stack; !in_temp.empty(); in_temp.pop()) {
-            temp.push(in_temp.top());
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            grow(new_capacity);
         }
+    }
 
-        while (!temp.empty()) {
-            reversed.enqueue(std::move(temp.top()));
-            temp.pop();
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < size_; ++i) {
+                AllocTraits::destroy(allocator_, slot(i));
+            }
         }
+        head_ = 0;
+        size_ = 0;
+    }
 
+    // Utilities
+
+    Queue reverse() const {
+        Queue reversed;
+        reversed.reserve(size_);
+        for (size_t i = size_; i > 0; --i) {
+            reversed.push_back(*slot(i - 1));
+        }
         return reversed;
     }
 
     void swap(Queue& other) noexcept {
-        input_stack.swap(other.input_stack);
-        output_stack.swap(other.output_stack);
+        std::swap(buffer_, other.buffer_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+        std::swap(allocator_, other.allocator_);
     }
 
     void print_queue() const {
-        Stack<T> temp_output = output_stack;
-        Stack<T> temp_input = input_stack;
-        Stack<T> print_stack;
-
-        while (!temp_output.empty()) {
-            std::cout << temp_output.top() << " ";
-            temp_output.pop();
-        }
-
-        while (!temp_input.empty()) {
-            print_stack.push(temp_input.top());
-            temp_input.pop();
-        }
-
-        while (!print_stack.empty()) {
-            std::cout << print_stack.top() << " ";
-            print_stack.pop();
+        for (size_t i = 0; i < size_; ++i) {
+            std::cout << *slot(i) << " ";
         }
         std::cout << std::endl;
     }
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "PriorityQueue.hpp"
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::containers {
+
+// Monotone min-priority queue for integer priorities (Dijkstra, event simulation, timers)
+// A pushed priority must not be below the last one returned by top or extract_min,
+// unless the heap is empty
+//
+// Bucket i holds the elements whose key differs from the last observed minimum in bit i - 1
+// (and no higher bit), bucket 0 holds the ones equal to it. When bucket 0 runs dry the first
+// non-empty bucket is redistributed around its minimum and every element drops to a strictly
+// lower bucket, so an element moves at most 64 times: amortized O(log C) with no comparisons
+// between elements besides the min scan
+//
+// Same push(priority, item) / extract_min interface as PriorityQueue, but the minimum wins
+template <typename T>
+class RadixHeap {
+  private:
+    static constexpr size_t BUCKETS = 65;
+
+    // Refilling bucket 0 only regroups the elements, so it's allowed from const methods
+    mutable DynamicArray<PriorityNode<T>> buckets_[BUCKETS];
+    mutable uint64_t last_ = 0;  // key of the last observed minimum, no stored key is below it
+    size_t size_ = 0;
+
+    // Order-preserving map of signed priorities onto unsigned keys
+    static uint64_t key_of(long priority) noexcept {
+        return static_cast<uint64_t>(priority) ^ (uint64_t{1} << 63);
+    }
+
+    size_t bucket_for(uint64_t key) const noexcept {
+        return static_cast<size_t>(std::bit_width(key ^ last_));
+    }
+
+    // Refills bucket 0 from the first non-empty bucket
+    void pull() const {
+        size_t index = 1;
+        while (buckets_[index].empty()) {
+            ++index;
+        }
+
+        DynamicArray<PriorityNode<T>>& bucket = buckets_[index];
+        uint64_t min_key = key_of(bucket[0].priority);
+        for (size_t i = 1; i < bucket.size(); ++i) {
+            const uint64_t key = key_of(bucket[i].priority);
+            min_key = key < min_key ? key : min_key;
+        }
+
+        last_ = min_key;
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            buckets_[bucket_for(key_of(bucket[i].priority))].push_back(std::move(bucket[i]));
+        }
+        bucket.clear();
+    }
+
+  public:
+    using value_type = PriorityNode<T>;
+    using const_reference = const value_type&;
+    using size_type = size_t;
+
+    RadixHeap() = default;
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    const_reference top() const {
+        if (empty()) {
+            throw std::runtime_error("Priority queue is empty");
+        }
+        if (buckets_[0].empty()) {
+            pull();
+        }
+        return buckets_[0].back();
+    }
+
+    void push(const long priority, const T& item) {
+        const uint64_t key = key_of(priority);
+        if (empty()) {
+            last_ = 0;  // an empty heap accepts any priority
+        } else if (key < last_) {
+            throw std::invalid_argument("Priority is below the last extracted one");
+        }
+
+        buckets_[bucket_for(key)].push_back(value_type(priority, item));
+        ++size_;
+    }
+
+    void pop() {
+        top();
+        buckets_[0].pop_back();
+        --size_;
+    }
+
+    T extract_min() {
+        top();
+        T result = std::move(buckets_[0].back().item);
+        buckets_[0].pop_back();
+        --size_;
+        return result;
+    }
+
+    void clear() noexcept {
+        for (auto& bucket : buckets_) {
+            bucket.clear();
+        }
+        last_ = 0;
+        size_ = 0;
+    }
+};
+}  // namespace ds::containers
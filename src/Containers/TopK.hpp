@@ -0,0 +1,141 @@
+#pragma once
+
+#include "DynamicArray.hpp"
+#include "HeapAlgorithms.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+namespace ds::containers {
+
+// Streaming top-K selection: keeps the K greatest elements (by Compare) seen so far
+// in a fixed-size heap whose root is the weakest kept element (the threshold)
+//
+// Once the heap is full most of a long stream loses to the threshold. push_range compares
+// whole blocks against it first with a branch-free loop that the compiler vectorizes for
+// arithmetic types, and only walks the rare blocks that contain a candidate
+//
+// Accumulators are independent, so parallel top-K is one TopK per thread followed by merge()
+template <typename T, typename Compare = std::less<T>>
+class TopK {
+  private:
+    static constexpr size_t ARITY = 4;
+    static constexpr size_t BLOCK = 16;
+
+    DynamicArray<T, HeapAllocator<T>> heap_;  // min-heap by comp_, root = threshold
+    size_t k_;
+    Compare comp_;
+
+    auto before() const {
+        return [this](const T& a, const T& b) { return comp_(a, b); };
+    }
+
+    void offer(const T& item) {
+        if (heap_.size() < k_) {
+            heap_.push_back(item);
+            heap_sift_up<ARITY>(heap_.begin(), heap_.size() - 1, before());
+        } else if (comp_(heap_[0], item)) {
+            heap_[0] = item;
+            heap_sift_down<ARITY>(heap_.begin(), heap_.size(), 0, before());
+        }
+    }
+
+  public:
+    explicit TopK(size_t k, const Compare& compare = Compare()) : k_(k), comp_(compare) {
+        heap_.reserve(k);
+    }
+
+    size_t k() const noexcept {
+        return k_;
+    }
+
+    size_t size() const noexcept {
+        return heap_.size();
+    }
+
+    bool empty() const noexcept {
+        return heap_.empty();
+    }
+
+    bool full() const noexcept {
+        return heap_.size() == k_;
+    }
+
+    // The weakest kept element, anything that doesn't beat it is ignored once the heap is full
+    const T& threshold() const {
+        if (heap_.empty()) {
+            throw std::runtime_error("TopK is empty");
+        }
+        return heap_[0];
+    }
+
+    void push(const T& item) {
+        if (k_ != 0) {
+            offer(item);
+        }
+    }
+
+    void push_range(const T* items, size_t count) {
+        if (k_ == 0) {
+            return;
+        }
+
+        size_t i = 0;
+        while (i < count && !full()) {
+            offer(items[i++]);
+        }
+
+        for (; i + BLOCK <= count; i += BLOCK) {
+            // pre-filter: no early exit and no data-dependent branch, so this is a few SIMD compares
+            const T& threshold = heap_[0];
+            bool any = false;
+            for (size_t j = 0; j < BLOCK; ++j) {
+                any |= comp_(threshold, items[i + j]);
+            }
+            if (any) {
+                for (size_t j = 0; j < BLOCK; ++j) {
+                    offer(items[i + j]);
+                }
+            }
+        }
+
+        for (; i < count; ++i) {
+            offer(items[i]);
+        }
+    }
+
+    template <typename InputIt>
+    void push_range(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            push(*first);
+        }
+    }
+
+    void push_range(const DynamicArray<T>& items) {
+        push_range(items.cbegin(), items.size());
+    }
+
+    // Folds another accumulator (e.g. from another thread) into this one
+    void merge(const TopK& other) {
+        for (size_t i = 0; i < other.heap_.size(); ++i) {
+            push(other.heap_[i]);
+        }
+    }
+
+    // The kept elements, best first
+    DynamicArray<T> sorted() const {
+        DynamicArray<T> result;
+        result.reserve(heap_.size());
+        for (size_t i = 0; i < heap_.size(); ++i) {
+            result.push_back(heap_[i]);
+        }
+        std::sort(result.begin(), result.end(), [this](const T& a, const T& b) { return comp_(b, a); });
+        return result;
+    }
+
+    void clear() noexcept {
+        heap_.clear();
+    }
+};
+}  // namespace ds::containers
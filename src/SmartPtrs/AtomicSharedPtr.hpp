@@ -0,0 +1,178 @@
+#pragma once
+
+#include "ControlBlock.hpp"
+#include "SharedPtr.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+namespace ds::smart_ptrs {
+
+// SharedPtr<T> slot with atomic load / store / exchange / compare_exchange, readers never lock
+// (configuration snapshots published to many threads)
+//
+// Split reference count: the slot is a single 64-bit word holding the control block pointer
+// (low 48 bits) and a local count (high 16 bits). A stored block is topped up with RESERVE strong
+// references owned by the slot. load() bumps the local count with one fetch_add, which hands it one
+// of those references: the block can't die under it because the same atomic op that picked the
+// pointer also claimed the reference. When the local count gets high, a reader moves it back into
+// the block's strong count. A writer swapping the word out gives back the references the readers
+// didn't claim
+//
+// While a block is stored, use_count() of its SharedPtrs includes the slot's unclaimed reserve
+template <typename T>
+class AtomicSharedPtr {
+  private:
+    using ControlBlock = BaseControlBlock<AtomicCounter>;
+
+    static constexpr int COUNT_SHIFT = 48;
+    static constexpr uint64_t POINTER_MASK = (uint64_t{1} << COUNT_SHIFT) - 1;
+    static constexpr uint64_t ONE_LOAD = uint64_t{1} << COUNT_SHIFT;
+    static constexpr int RESERVE = 1 << 15;     // the local count stays far below 2^16
+    static constexpr int REFILL_AT = RESERVE / 2;
+
+    static_assert(sizeof(void*) == 8, "AtomicSharedPtr packs a pointer and a count into 64 bits");
+
+    mutable std::atomic<uint64_t> state_;
+
+    static ControlBlock* block_of(uint64_t state) noexcept {
+        return reinterpret_cast<ControlBlock*>(static_cast<uintptr_t>(state & POINTER_MASK));
+    }
+
+    static int loads_of(uint64_t state) noexcept {
+        return static_cast<int>(state >> COUNT_SHIFT);
+    }
+
+    static uint64_t pack(ControlBlock* cb) noexcept {
+        const auto bits = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(cb));
+        assert((bits & ~POINTER_MASK) == 0 && "pointer doesn't fit in 48 bits");
+        return bits;
+    }
+
+    static SharedPtr<T> adopt(ControlBlock* cb) noexcept {
+        return cb ? SharedPtr<T>(static_cast<T*>(cb->get_pointer()), cb) : SharedPtr<T>();
+    }
+
+    // Takes over desired's reference and adds the reserve for readers
+    static uint64_t acquire(SharedPtr<T>& desired) noexcept {
+        ControlBlock* cb = std::exchange(desired.ctr_block_, nullptr);
+        desired.ptr_ = nullptr;
+        if (cb) {
+            cb->increment_shared(RESERVE);
+        }
+        return pack(cb);
+    }
+
+    // Turns a state that was swapped out into one owning SharedPtr, the unclaimed reserve is dropped
+    static SharedPtr<T> retire(uint64_t state) noexcept {
+        ControlBlock* cb = block_of(state);
+        if (cb) {
+            // the slot owned RESERVE + 1 references and readers claimed loads_of(state) of them,
+            // one is kept for the result, so this never drops the count to zero
+            cb->decrement_shared(RESERVE - loads_of(state));
+        }
+        return adopt(cb);
+    }
+
+    // Moves the references claimed by readers back into the block's strong count
+    void refill(ControlBlock* cb) const noexcept {
+        uint64_t current = state_.load(std::memory_order_relaxed);
+        while (block_of(current) == cb && loads_of(current) >= REFILL_AT) {
+            const int claimed = loads_of(current);
+            cb->increment_shared(claimed);
+            if (state_.compare_exchange_weak(current, pack(cb), std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return;
+            }
+            cb->decrement_shared(claimed);  // can't reach zero: the caller holds a reference
+        }
+    }
+
+  public:
+    AtomicSharedPtr() noexcept : state_(0) {}
+
+    explicit AtomicSharedPtr(SharedPtr<T> desired) noexcept : state_(acquire(desired)) {}
+
+    AtomicSharedPtr(const AtomicSharedPtr&) = delete;
+    AtomicSharedPtr& operator=(const AtomicSharedPtr&) = delete;
+
+    ~AtomicSharedPtr() noexcept {
+        retire(state_.load(std::memory_order_acquire));
+    }
+
+    static constexpr bool is_always_lock_free = std::atomic<uint64_t>::is_always_lock_free;
+
+    bool is_lock_free() const noexcept {
+        return state_.is_lock_free();
+    }
+
+    SharedPtr<T> load() const noexcept {
+        if (state_.load(std::memory_order_relaxed) == 0) {
+            return SharedPtr<T>();
+        }
+
+        const uint64_t state = state_.fetch_add(ONE_LOAD, std::memory_order_acquire);
+        ControlBlock* cb = block_of(state);
+        if (cb == nullptr) {
+            // emptied in the meantime: take the count back unless the word was replaced again
+            uint64_t current = state + ONE_LOAD;
+            while (block_of(current) == nullptr && loads_of(current) > 0 &&
+                   !state_.compare_exchange_weak(current, current - ONE_LOAD, std::memory_order_relaxed)) {
+            }
+            return SharedPtr<T>();
+        }
+
+        if (loads_of(state) + 1 >= REFILL_AT) {
+            refill(cb);
+        }
+        return adopt(cb);
+    }
+
+    void store(SharedPtr<T> desired) noexcept {
+        exchange(std::move(desired));
+    }
+
+    SharedPtr<T> exchange(SharedPtr<T> desired) noexcept {
+        return retire(state_.exchange(acquire(desired), std::memory_order_acq_rel));
+    }
+
+    // Compares control blocks, on failure expected receives the current value
+    bool compare_exchange_strong(SharedPtr<T>& expected, SharedPtr<T> desired) noexcept {
+        ControlBlock* wanted = expected.ctr_block_;
+        ControlBlock* next = desired.ctr_block_;
+        if (next) {
+            next->increment_shared(RESERVE);
+        }
+
+        uint64_t current = state_.load(std::memory_order_relaxed);
+        while (block_of(current) == wanted) {
+            // a failure caused by readers only changes the local count, so it's retried
+            if (state_.compare_exchange_weak(current, pack(next), std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                desired.ctr_block_ = nullptr;  // its reference now belongs to the slot
+                desired.ptr_ = nullptr;
+                retire(current);
+                return true;
+            }
+        }
+
+        if (next) {
+            next->decrement_shared(RESERVE);  // desired still holds a reference
+        }
+        expected = load();
+        return false;
+    }
+
+    bool compare_exchange_weak(SharedPtr<T>& expected, SharedPtr<T> desired) noexcept {
+        return compare_exchange_strong(expected, std::move(desired));
+    }
+
+    operator SharedPtr<T>() const noexcept {
+        return load();
+    }
+
+    AtomicSharedPtr& operator=(SharedPtr<T> desired) noexcept {
+        store(std::move(desired));
+        return *this;
+    }
+};
+}  // namespace ds::smart_ptrs
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace ds::smart_ptrs {
+
+class BiasedCounter;
+
+// Per-thread state of biased reference counting: identifies the owner thread of a counter
+// and collects the counters other threads need the owner to merge
+//
+// Records are never freed. A record whose thread exited is orphaned and handed to the next new
+// thread, which inherits the biased counts with it. While a record has no thread, whoever queues
+// a counter on it merges the queue itself under the record's mutex
+class BiasedOwner {
+  private:
+    std::atomic<BiasedCounter*> pending_{nullptr};
+    std::atomic<bool> orphaned_{false};
+    std::mutex mutex_;
+    BiasedOwner* next_free_ = nullptr;
+
+    friend class BiasedCounter;
+
+    struct Registry {
+        std::mutex mutex;
+        BiasedOwner* free = nullptr;
+    };
+
+    static Registry& registry() noexcept {
+        static Registry registry;
+        return registry;
+    }
+
+    // Orphans the record when its thread exits
+    struct Holder {
+        BiasedOwner* record = nullptr;
+
+        ~Holder();
+    };
+
+    // Both trivially destructible, so they stay readable during later thread_local destructors
+    inline static thread_local BiasedOwner* current_ = nullptr;
+    inline static thread_local bool exited_ = false;
+
+    static BiasedOwner* adopt();
+
+    // Merges every queued counter, must run as the owner (the owner thread or a lock holder)
+    void drain() noexcept;
+
+    void enqueue(BiasedCounter* counter) noexcept;
+
+  public:
+    // Record of the calling thread, nullptr once the thread is shutting down
+    static BiasedOwner* current() {
+        if (current_ == nullptr && !exited_) {
+            thread_local Holder holder;
+            holder.record = adopt();
+            current_ = holder.record;
+        }
+        return current_;
+    }
+
+    // Merges the counters that other threads released below zero
+    // Also done automatically when the thread creates biased counters and when it exits
+    static void collect() noexcept {
+        if (BiasedOwner* owner = current_; owner != nullptr) {
+            owner->drain();
+        }
+    }
+};
+
+// Biased reference count (Choi, Shull, Torrellas 2018) for SharedPtr / WeakPtr control blocks:
+// SharedPtr<T, BiasedCounter>
+//
+// Objects are mostly copied by the thread that created them. That thread (the owner) counts in a
+// plain integer, the other threads in an atomic one that may go negative: a reference made by the
+// owner can be dropped elsewhere. When the owner's count reaches zero it merges both counts into
+// the atomic one for good and the object lives on as an ordinary atomically counted one
+//
+// If the atomic count first goes negative before that (the owner's references moved away),
+// the counter is queued to its owner, which merges it the next time it creates a biased counter,
+// releases a reference to a queued one, calls BiasedOwner::collect() or exits. Until then the
+// object stays alive even if nothing points to it anymore
+//
+// Only for control blocks: the block registers what to do when a merge finds no references left
+class BiasedCounter {
+  private:
+    // shared_ = count * UNIT | flags, the count is signed
+    static constexpr int64_t MERGED = 1;
+    static constexpr int64_t QUEUED = 2;
+    static constexpr int64_t UNIT = 4;
+
+    BiasedOwner* owner_;
+    int biased_ = 0;      // owner only
+    bool merged_ = true;  // owner only, mirrors MERGED
+    std::atomic<int64_t> shared_{MERGED};
+
+    BiasedCounter* next_pending_ = nullptr;
+    void (*on_zero_)(void*) noexcept = nullptr;
+    void* context_ = nullptr;
+
+    friend class BiasedOwner;
+
+    static int64_t count_of(int64_t shared) noexcept {
+        return shared >> 2;
+    }
+
+    // merged_ may only be read once the owner check passed
+    bool owned_here() const {
+        return owner_ == BiasedOwner::current() && !merged_;
+    }
+
+    // Folds the owner's count into the atomic one, returns the total number of references
+    int64_t merge() noexcept {
+        const int64_t old = shared_.fetch_add(biased_ * UNIT + MERGED, std::memory_order_acq_rel);
+        const int64_t total = count_of(old) + biased_;
+        biased_ = 0;
+        merged_ = true;
+        return total;
+    }
+
+    // The owner releases its last n biased references or any of a queued counter: merge, then drop
+    // them from the total
+    bool release_biased(int n) noexcept {
+        int64_t current = shared_.load(std::memory_order_relaxed);
+        while (true) {
+            if (current & QUEUED) {
+                // queued counters are only merged by drain(), otherwise the queue could keep a freed one.
+                // The releaser that set the flag may not have pushed the counter yet
+                while (!merged_) {
+                    owner_->drain();  // our references keep the counter alive
+                    if (!merged_) {
+                        std::this_thread::yield();
+                    }
+                }
+                return count_of(shared_.fetch_sub(n * UNIT, std::memory_order_acq_rel)) == n;
+            }
+            const int64_t merged = current + (biased_ - n) * UNIT + MERGED;
+            if (shared_.compare_exchange_weak(current, merged, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                const int64_t total = count_of(current) + biased_ - n;
+                biased_ = 0;
+                merged_ = true;
+                return total == 0;
+            }
+        }
+    }
+
+  public:
+    explicit BiasedCounter(int initial = 0) : owner_(BiasedOwner::current()) {
+        if (owner_ != nullptr) {
+            owner_->drain();
+            biased_ = initial;
+            merged_ = false;
+            shared_.store(0, std::memory_order_relaxed);
+        } else {
+            shared_.store(initial * UNIT + MERGED, std::memory_order_relaxed);
+        }
+    }
+
+    BiasedCounter(const BiasedCounter&) = delete;
+    BiasedCounter& operator=(const BiasedCounter&) = delete;
+
+    // Called with context when a merge on behalf of another thread finds no references left
+    void on_zero(void (*callback)(void*) noexcept, void* context) noexcept {
+        on_zero_ = callback;
+        context_ = context;
+    }
+
+    void increment(int n = 1) {
+        if (owned_here()) {
+            biased_ += n;
+        } else {
+            shared_.fetch_add(n * UNIT, std::memory_order_relaxed);
+        }
+    }
+
+    // Returns true if these were the last references
+    bool decrement(int n = 1) {
+        if (owned_here()) {
+            // a plain load, no atomic read-modify-write on the owner's path
+            if (biased_ > n && !(shared_.load(std::memory_order_relaxed) & QUEUED)) {
+                biased_ -= n;
+                return false;
+            }
+            return release_biased(n);
+        }
+
+        // the owner still counts these references, unless this is the first time the shared part
+        // goes negative: then the owner may have nothing left to release and gets the counter queued.
+        // The flag is set in the same step, after it the owner can't free the counter without us
+        int64_t current = shared_.load(std::memory_order_relaxed);
+        while (true) {
+            int64_t desired = current - n * UNIT;
+            if (!(current & (MERGED | QUEUED)) && count_of(desired) < 0) {
+                desired |= QUEUED;
+            }
+            if (shared_.compare_exchange_weak(current, desired, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        if (current & MERGED) {
+            return count_of(current) == n;
+        }
+        if (!(current & QUEUED) && count_of(current) - n < 0) {
+            owner_->enqueue(this);
+        }
+        return false;
+    }
+
+    // Increments unless the count already dropped to zero (WeakPtr::lock)
+    bool try_increment() {
+        if (owned_here()) {
+            ++biased_;  // not merged yet, so the owner still holds references
+            return true;
+        }
+
+        int64_t current = shared_.load(std::memory_order_relaxed);
+        while (true) {
+            // unmerged means the owner holds references
+            if ((current & MERGED) && count_of(current) <= 0) {
+                return false;
+            }
+            if (shared_.compare_exchange_weak(current, current + UNIT, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    // Exact on the owner thread and after the merge, otherwise only the shared part is known
+    int load() const {
+        const int64_t shared = shared_.load(std::memory_order_acquire);
+        if (shared & MERGED) {
+            return static_cast<int>(count_of(shared));
+        }
+        if (owner_ == BiasedOwner::current()) {
+            return static_cast<int>(count_of(shared) + biased_);
+        }
+        return static_cast<int>(count_of(shared) > 0 ? count_of(shared) + 1 : 1);
+    }
+
+    // Whether the calling thread counts without atomics right now
+    bool biased() const {
+        return owned_here();
+    }
+};
+
+inline BiasedOwner* BiasedOwner::adopt() {
+    Registry& reg = registry();
+    BiasedOwner* record = nullptr;
+    {
+        std::lock_guard guard(reg.mutex);
+        if (reg.free != nullptr) {
+            record = reg.free;
+            reg.free = record->next_free_;
+        }
+    }
+
+    if (record == nullptr) {
+        return new BiasedOwner();
+    }
+
+    // from here on queued counters wait for this thread instead of being merged by their releasers
+    std::lock_guard guard(record->mutex_);
+    record->orphaned_.store(false, std::memory_order_seq_cst);
+    record->drain();
+    return record;
+}
+
+inline BiasedOwner::Holder::~Holder() {
+    current_ = nullptr;
+    exited_ = true;
+    if (record == nullptr) {
+        return;
+    }
+
+    // a releaser that queues after this store merges the queue itself
+    record->orphaned_.store(true, std::memory_order_seq_cst);
+    {
+        std::lock_guard guard(record->mutex_);
+        record->drain();
+    }
+
+    Registry& reg = registry();
+    std::lock_guard guard(reg.mutex);
+    record->next_free_ = reg.free;
+    reg.free = record;
+}
+
+inline void BiasedOwner::drain() noexcept {
+    if (pending_.load(std::memory_order_relaxed) == nullptr) {
+        return;
+    }
+    BiasedCounter* counter = pending_.exchange(nullptr, std::memory_order_acquire);
+    while (counter != nullptr) {
+        BiasedCounter* next = counter->next_pending_;  // the counter may be destroyed below
+        if (!counter->merged_ && counter->merge() == 0 && counter->on_zero_ != nullptr) {
+            counter->on_zero_(counter->context_);
+        }
+        counter = next;
+    }
+}
+
+inline void BiasedOwner::enqueue(BiasedCounter* counter) noexcept {
+    BiasedCounter* head = pending_.load(std::memory_order_relaxed);
+    do {
+        counter->next_pending_ = head;
+    } while (!pending_.compare_exchange_weak(head, counter, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+    // the owner is gone: act as the owner
+    if (orphaned_.load(std::memory_order_seq_cst)) {
+        std::lock_guard guard(mutex_);
+        if (orphaned_.load(std::memory_order_relaxed)) {
+            drain();
+        }
+    }
+}
+}  // namespace ds::smart_ptrs
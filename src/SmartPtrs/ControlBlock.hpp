@@ -1,6 +1,11 @@
 #pragma once
 
+#include "BiasedCounter.hpp"
+#include "ControlBlockPool.hpp"
+#include "RefCount.hpp"
 #include <atomic>
+#include <cstdint>
+#include <memory>
 #include <functional>
 #include <new>
 #include <type_traits>
@@ -8,134 +13,363 @@
 
 namespace ds::smart_ptrs {
 
-template <typename T>
+template <typename T, typename Counter = AtomicCounter>
 class SharedPtr;
 
-template <typename T>
+template <typename T, typename Counter = AtomicCounter>
 class WeakPtr;
 
-// Abstract base class for control block
+// Strong and weak counts of a control block
+// The weak count holds one extra reference on behalf of all the strong ones together
+template <typename Counter>
+class BlockCounts {
+  private:
+    Counter shared_{1};
+    Counter weak_{1};
+
+  public:
+    void increment_shared(int n) noexcept {
+        shared_.increment(n);
+    }
+
+    bool decrement_shared(int n) noexcept {
+        return shared_.decrement(n);
+    }
+
+    bool try_increment_shared() noexcept {
+        return shared_.try_increment();
+    }
+
+    int shared() const noexcept {
+        return shared_.load();
+    }
+
+    void increment_weak() noexcept {
+        weak_.increment();
+    }
+
+    bool decrement_weak() noexcept {
+        return weak_.decrement();
+    }
+
+    int weak() const noexcept {
+        return weak_.load();
+    }
+
+    // Whether the caller holds the only reference of any kind: nobody can add one anymore
+    bool sole() const noexcept {
+        return shared_.load() == 1 && weak_.load() == 1;
+    }
+};
+
+// Both atomic counts in one 64-bit word, the strong count in the low half
+template <>
+class BlockCounts<AtomicCounter> {
+  private:
+    static constexpr uint64_t SHARED = 1;
+    static constexpr uint64_t WEAK = uint64_t{1} << 32;
+    static constexpr uint64_t SHARED_MASK = WEAK - 1;
+
+    std::atomic<uint64_t> word_{SHARED + WEAK};
+
+  public:
+    void increment_shared(int n) noexcept {
+        word_.fetch_add(n * SHARED, std::memory_order_relaxed);
+    }
+
+    bool decrement_shared(int n) noexcept {
+        return (word_.fetch_sub(n * SHARED, std::memory_order_acq_rel) & SHARED_MASK) == static_cast<uint64_t>(n);
+    }
+
+    bool try_increment_shared() noexcept {
+        uint64_t current = word_.load(std::memory_order_relaxed);
+        while ((current & SHARED_MASK) != 0) {
+            if (word_.compare_exchange_weak(current, current + SHARED, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int shared() const noexcept {
+        return static_cast<int>(word_.load(std::memory_order_acquire) & SHARED_MASK);
+    }
+
+    void increment_weak() noexcept {
+        word_.fetch_add(WEAK, std::memory_order_relaxed);
+    }
+
+    bool decrement_weak() noexcept {
+        return (word_.fetch_sub(WEAK, std::memory_order_acq_rel) >> 32) == 1;
+    }
+
+    int weak() const noexcept {
+        return static_cast<int>(word_.load(std::memory_order_acquire) >> 32);
+    }
+
+    // one acquire load: what the other references did before going away is visible
+    bool sole() const noexcept {
+        return word_.load(std::memory_order_acquire) == SHARED + WEAK;
+    }
+};
+
+// Only the strong count is biased, weak references are rare enough to stay atomic
+template <>
+class BlockCounts<BiasedCounter> {
+  private:
+    BiasedCounter shared_{1};
+    AtomicCounter weak_{1};
+
+  public:
+    // See BiasedCounter::on_zero
+    void on_zero(void (*callback)(void*) noexcept, void* context) noexcept {
+        shared_.on_zero(callback, context);
+    }
+
+    void increment_shared(int n) noexcept {
+        shared_.increment(n);
+    }
+
+    bool decrement_shared(int n) noexcept {
+        return shared_.decrement(n);
+    }
+
+    bool try_increment_shared() noexcept {
+        return shared_.try_increment();
+    }
+
+    int shared() const noexcept {
+        return shared_.load();
+    }
+
+    void increment_weak() noexcept {
+        weak_.increment();
+    }
+
+    bool decrement_weak() noexcept {
+        return weak_.decrement();
+    }
+
+    int weak() const noexcept {
+        return weak_.load();
+    }
+
+    // other threads may still hold references the owner doesn't see
+    bool sole() const noexcept {
+        return false;
+    }
+};
+
+// What a control block's manager function is asked to do
+enum class ControlBlockOperation {
+    Pointer,        // return the address of the managed object
+    DestroyObject,  // destroy the object (e.g., delete ptr_)
+    DestroySelf,    // free the control block itself
+    DestroyAll,     // both, for the last reference of any kind
+};
+
+// Base of the control blocks, without virtual functions
+// Counter (see RefCount.hpp, BiasedCounter.hpp) decides how the counts are kept
+//
+// Instead of a vtable the block stores one function pointer to the static manager of its concrete
+// type. With the default AtomicCounter both counts share one 64-bit word, so the block header is
+// two words and releasing the last reference of an object nobody observes costs an acquire load
+// and a single indirect call
+template <typename Counter = AtomicCounter>
 class BaseControlBlock {
   protected:
-    std::atomic<int> shared_count_;  // Number of strong references
-    std::atomic<int> weak_count_;    // Number of weak references
+    using Manager = void* (*)(BaseControlBlock*, ControlBlockOperation) noexcept;
 
-  public:
+  private:
+    BlockCounts<Counter> counts_;
+    Manager manager_;
+
+    // Run by a biased merge that finds no references left on behalf of another thread
+    static void release_merged(void* block) noexcept {
+        static_cast<BaseControlBlock*>(block)->release_object();
+    }
+
+    // The last strong reference is gone
+    void release_object() noexcept {
+        manager_(this, ControlBlockOperation::DestroyObject);
+        release_weak();
+    }
+
+  protected:
     // Constructor initialise counts
     // for the first shared_ptr, shared_count is 1 (the pointer itself)
     // and weak count is 1 too, (the control block exists as long as there's shared_ptr or weak_ptr)
-    BaseControlBlock() noexcept : shared_count_(1), weak_count_(1) {}
+    explicit BaseControlBlock(Manager manager) noexcept : manager_(manager) {
+        if constexpr (std::is_same_v<Counter, BiasedCounter>) {
+            counts_.on_zero(&release_merged, this);
+        }
+    }
 
+    // blocks are destroyed by their manager as the concrete type
+    ~BaseControlBlock() = default;
+
+  public:
     // Delete copy behaviour for safety bc control blocks are managed internally and should not be copied explicitly
     BaseControlBlock(const BaseControlBlock& other) = delete;
     BaseControlBlock& operator=(const BaseControlBlock& other) = delete;
 
-    virtual ~BaseControlBlock() = default;
-
-    void increment_shared() noexcept {
-        shared_count_.fetch_add(1, std::memory_order_relaxed);
+    void increment_shared(int n = 1) noexcept {
+        counts_.increment_shared(n);
     }
 
-    // Decrement shared counter using acquire-release memory order
-    // This function returns true if the count __was__ 1 before decrement
-    // (hence it became 0 after the subtraction)
-    // This one sync with memory operations that lead to object destruction
-    bool decrement_shared() noexcept {
-        return shared_count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    // Drops n strong references that can't be the last ones (AtomicSharedPtr's reserve),
+    // returns true if the count __was__ n before decrement. SharedPtr uses release_shared()
+    bool decrement_shared(int n = 1) noexcept {
+        return counts_.decrement_shared(n);
     }
 
-    // Read shared count (acquire memory order to ensure the latest value visibility)
     size_t use_count() const noexcept {
-        return static_cast<size_t>(shared_count_.load(std::memory_order_acquire));
+        return static_cast<size_t>(counts_.shared());
     }
 
-    // Attempt to increment count atomically
     // Returns true if successfull => if shared_count_ was > 0 and was incremented
     bool try_increment_shared() noexcept {
-        int old_count = shared_count_.load(std::memory_order_relaxed);
-
-        for (;;) {
-            if (old_count == 0) {  // hence object is already destroyed
-                return false;
-            }
-
-            // atomically try to increment and if old_count has changed => loop again
-            if (shared_count_.compare_exchange_weak(old_count, old_count + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
-                return true;
-            }
-        }
+        return counts_.try_increment_shared();
     }
 
     void increment_weak() noexcept {
-        weak_count_.fetch_add(1, std::memory_order_relaxed);
+        counts_.increment_weak();
     }
 
-    // Works similarly as for shared counter
-    // => returns true if weak counter was 1 __before__ decrement
-    bool decrement_weak() noexcept {
-        return weak_count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    size_t weak_use_count() const noexcept {
+        return static_cast<size_t>(counts_.weak());
     }
 
-    size_t weak_use_count() const noexcept {
-        return static_cast<size_t>(weak_count_.load(std::memory_order_acquire));
+    // Drops one strong reference, destroys the object after the last one
+    // and the block once there are no weak references either
+    void release_shared() noexcept {
+        if (counts_.sole()) {
+            manager_(this, ControlBlockOperation::DestroyAll);
+        } else if (counts_.decrement_shared(1)) {
+            release_object();
+        }
     }
 
-    // Abstract methods to destroy the managed object and the control blovk itself
-    virtual void destroy_obj() noexcept = 0;   // deletes the object (e.g., delete ptr_)
-    virtual void destroy_self() noexcept = 0;  // deletes control block instance (e.g., delete __this__)
+    // Drops one weak reference
+    void release_weak() noexcept {
+        if (counts_.decrement_weak()) {
+            manager_(this, ControlBlockOperation::DestroySelf);
+        }
+    }
+
+    // Address of the managed object, lets AtomicSharedPtr get by with a pointer to the block alone
+    void* get_pointer() noexcept {
+        return manager_(this, ControlBlockOperation::Pointer);
+    }
 };
 
-template <typename T>
-class DefaultControlBlock : public BaseControlBlock {
+template <typename T, typename Counter = AtomicCounter>
+class DefaultControlBlock : public BaseControlBlock<Counter> {
   private:
+    using Base = BaseControlBlock<Counter>;
+
     T* ptr_;
 
+    static void* manage(Base* base, ControlBlockOperation operation) noexcept {
+        auto* self = static_cast<DefaultControlBlock*>(base);
+        switch (operation) {
+            case ControlBlockOperation::Pointer:
+                return const_cast<std::remove_cv_t<T>*>(self->ptr_);
+            case ControlBlockOperation::DestroyObject:
+                delete self->ptr_;
+                break;
+            case ControlBlockOperation::DestroyAll:
+                delete self->ptr_;
+                delete self;
+                break;
+            case ControlBlockOperation::DestroySelf:
+                delete self;
+                break;
+        }
+        return nullptr;
+    }
+
   public:
-    explicit DefaultControlBlock(T* ptr) noexcept : ptr_(ptr) {}
+    explicit DefaultControlBlock(T* ptr) noexcept : Base(&manage), ptr_(ptr) {}
 
-    void destroy_obj() noexcept override {
-        delete ptr_;
+    // blocks come from the thread-caching pool instead of the global heap
+    static void* operator new(size_t bytes) {
+        return ControlBlockPool::allocate(bytes);
     }
 
-    void destroy_self() noexcept override {
-        delete this;
+    static void operator delete(void* ptr, size_t bytes) noexcept {
+        ControlBlockPool::deallocate(ptr, bytes);
     }
 };
 
-template <typename T>
-class MakeSharedControlBlock : public BaseControlBlock {
+// Control block and object in one allocation made through Allocator (allocate_shared / make_shared)
+// The block keeps a copy of the allocator, rebound to its own type, to free itself
+template <typename T, typename Allocator, typename Counter = AtomicCounter>
+class AllocateSharedControlBlock : public BaseControlBlock<Counter> {
   private:
-    // storage for the object. i use aligned storage here to ensure proper alignment and size
-    // the object itself is constructed in this storage using __placement new__
-    typename std::aligned_storage_t<sizeof(T), alignof(T)>::type obj_storage_;
+    using Base = BaseControlBlock<Counter>;
+    using ObjectAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using BlockAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<AllocateSharedControlBlock>;
 
-    // raw ptr to the object within object storage for convenience
-    // (it's the same memory as obj_storage_, but cast to T*)
-    T* ptr_;
+    [[no_unique_address]] BlockAllocator allocator_;
 
-  public:
-    template <typename... Args>
-    explicit MakeSharedControlBlock(Args&&... args) noexcept(noexcept(T(std::forward<Args>(args)...))) {
-        // construct T in allocated storage using placement new
-        ptr_ = new (&obj_storage_) T(std::forward<Args>(args)...);
+    // storage for the object, it is constructed here through the allocator
+    alignas(T) unsigned char obj_storage_[sizeof(T)];
+
+    // the object's memory is only freed with the whole block in destroy_self()
+    void destroy_obj() noexcept {
+        ObjectAllocator object_alloc(allocator_);
+        std::allocator_traits<ObjectAllocator>::destroy(object_alloc, get_object());
     }
 
-    // so, the memory itself will be freed when destroy_self() is called for the whole control block
-    void destroy_obj() noexcept override {
-        if (ptr_ != nullptr) {
-            ptr_->~T();
-            ptr_ = nullptr;
+    void destroy_self() noexcept {
+        BlockAllocator block_alloc(std::move(allocator_));
+        this->~AllocateSharedControlBlock();
+        std::allocator_traits<BlockAllocator>::deallocate(block_alloc, this, 1);
+    }
+
+    static void* manage(Base* base, ControlBlockOperation operation) noexcept {
+        auto* self = static_cast<AllocateSharedControlBlock*>(base);
+        switch (operation) {
+            case ControlBlockOperation::Pointer:
+                return const_cast<std::remove_cv_t<T>*>(self->get_object());
+            case ControlBlockOperation::DestroyObject:
+                self->destroy_obj();
+                break;
+            case ControlBlockOperation::DestroyAll:
+                self->destroy_obj();
+                self->destroy_self();
+                break;
+            case ControlBlockOperation::DestroySelf:
+                self->destroy_self();
+                break;
         }
+        return nullptr;
     }
 
-    // destroys th control block itself
-    void destroy_self() noexcept override {
-        // deallocates the whole block : MakeSharedControlBlock + T's storage
-        delete this;
+  public:
+    template <typename... Args>
+    explicit AllocateSharedControlBlock(const Allocator& alloc, Args&&... args) : Base(&manage), allocator_(alloc) {
+        ObjectAllocator object_alloc(allocator_);
+        std::allocator_traits<ObjectAllocator>::construct(object_alloc, get_object(), std::forward<Args>(args)...);
+    }
+
+    // Allocates a block and constructs the object in it, nothing leaks if the constructor throws
+    template <typename... Args>
+    static AllocateSharedControlBlock* create(const Allocator& alloc, Args&&... args) {
+        BlockAllocator block_alloc(alloc);
+        AllocateSharedControlBlock* block = std::allocator_traits<BlockAllocator>::allocate(block_alloc, 1);
+        try {
+            ::new (static_cast<void*>(block)) AllocateSharedControlBlock(alloc, std::forward<Args>(args)...);
+        } catch (...) {
+            std::allocator_traits<BlockAllocator>::deallocate(block_alloc, block, 1);
+            throw;
+        }
+        return block;
     }
 
-    T* get_object() const noexcept {
-        return ptr_;
+    T* get_object() noexcept {
+        return std::launder(reinterpret_cast<T*>(&obj_storage_));
     }
 };
 }  // namespace ds::smart_ptrs
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace ds::smart_ptrs {
+
+// Thread-caching free lists for the small allocations made by SharedPtr (control blocks,
+// and the fused block + object allocations of make_shared)
+//
+// Sizes are rounded up to 16-byte classes up to MAX_SIZE, bigger requests go straight to operator new.
+// Every thread keeps its own free list per class, so allocating and releasing a block is a couple
+// of pointer moves without locks or atomics. A block freed by another thread simply joins that
+// thread's cache. Each list is capped, the excess goes back to operator delete
+class ControlBlockPool {
+  public:
+    static constexpr size_t GRANULE = 16;
+    static constexpr size_t CLASSES = 8;
+    static constexpr size_t MAX_SIZE = GRANULE * CLASSES;
+    static constexpr size_t MAX_CACHED = 512;  // per class and thread
+
+  private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct Cache {
+        FreeNode* heads[CLASSES] = {};
+        size_t counts[CLASSES] = {};
+
+        ~Cache();
+    };
+
+    // Stays readable after the thread's Cache is destroyed (trivial destructor), so that
+    // SharedPtrs released by later thread_local or static destructors bypass the dead cache
+    inline static thread_local bool cache_destroyed_ = false;
+
+    static Cache& cache() noexcept {
+        thread_local Cache cache;
+        return cache;
+    }
+
+    static size_t class_of(size_t bytes) noexcept {
+        return (bytes + GRANULE - 1) / GRANULE - 1;
+    }
+
+  public:
+    static void* allocate(size_t bytes) {
+        if (bytes == 0 || bytes > MAX_SIZE) {
+            return ::operator new(bytes);
+        }
+
+        // always the full class size: the block may be freed into a live cache on another thread
+        const size_t index = class_of(bytes);
+        if (cache_destroyed_) {
+            return ::operator new((index + 1) * GRANULE);
+        }
+        Cache& local = cache();
+        if (FreeNode* node = local.heads[index]) {
+            local.heads[index] = node->next;
+            --local.counts[index];
+            return node;
+        }
+        return ::operator new((index + 1) * GRANULE);
+    }
+
+    static void deallocate(void* ptr, size_t bytes) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+        if (bytes == 0 || bytes > MAX_SIZE || cache_destroyed_) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        const size_t index = class_of(bytes);
+        Cache& local = cache();
+        if (local.counts[index] == MAX_CACHED) {
+            ::operator delete(ptr);
+            return;
+        }
+        local.heads[index] = ::new (ptr) FreeNode{local.heads[index]};
+        ++local.counts[index];
+    }
+
+    // Blocks cached by the calling thread for the class of `bytes`
+    static size_t cached(size_t bytes) noexcept {
+        return bytes == 0 || bytes > MAX_SIZE || cache_destroyed_ ? 0 : cache().counts[class_of(bytes)];
+    }
+};
+
+inline ControlBlockPool::Cache::~Cache() {
+    cache_destroyed_ = true;
+    for (FreeNode*& head : heads) {
+        while (head != nullptr) {
+            ::operator delete(std::exchange(head, head->next));
+        }
+    }
+}
+
+// Standard allocator interface over ControlBlockPool, used by make_shared
+// Over-aligned types bypass the pool
+template <typename T>
+class ControlBlockAllocator {
+  private:
+    static constexpr bool POOLED = alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  public:
+    using value_type = T;
+
+    ControlBlockAllocator() = default;
+
+    template <typename U>
+    ControlBlockAllocator(const ControlBlockAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        if constexpr (POOLED) {
+            return static_cast<T*>(ControlBlockPool::allocate(n * sizeof(T)));
+        } else {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        if constexpr (POOLED) {
+            ControlBlockPool::deallocate(ptr, n * sizeof(T));
+        } else {
+            ::operator delete(ptr, std::align_val_t{alignof(T)});
+        }
+    }
+
+    template <typename U>
+    bool operator==(const ControlBlockAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+}  // namespace ds::smart_ptrs
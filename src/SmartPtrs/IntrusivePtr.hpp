@@ -0,0 +1,162 @@
+#pragma once
+
+#include "RefCount.hpp"
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ds::smart_ptrs {
+
+// CRTP base that keeps the reference count inside the object: class Node : public RefCounted<Node> {...}
+// Counter is AtomicCounter (default) or PlainCounter for objects that never leave their thread
+//
+// The object is deleted through T* when the last IntrusivePtr goes away,
+// so a base of a polymorphic hierarchy needs a virtual destructor
+template <typename T, typename Counter = AtomicCounter>
+class RefCounted {
+  private:
+    mutable Counter count_{0};
+
+    // found by ADL from IntrusivePtr
+    friend void intrusive_add_ref(const RefCounted* object) noexcept {
+        object->count_.increment();
+    }
+
+    friend void intrusive_release(const RefCounted* object) noexcept {
+        if (object->count_.decrement()) {
+            delete static_cast<const T*>(object);
+        }
+    }
+
+  protected:
+    RefCounted() noexcept = default;
+
+    // a copy of the object is a new object, it doesn't inherit the references to the original
+    RefCounted(const RefCounted&) noexcept {}
+
+    RefCounted& operator=(const RefCounted&) noexcept {
+        return *this;
+    }
+
+    ~RefCounted() = default;
+
+  public:
+    size_t use_count() const noexcept {
+        return static_cast<size_t>(count_.load());
+    }
+};
+
+// Shared ownership of a RefCounted object with the count stored in the object itself
+// One word wide, a copy touches only the object's own cache line, there's no control block
+// and a raw pointer to a live object can always be turned back into an owning IntrusivePtr
+// No weak references: use SharedPtr / WeakPtr when cycles have to be broken
+template <typename T>
+class IntrusivePtr {
+  private:
+    T* ptr_;
+
+    template <typename U>
+    friend class IntrusivePtr;
+
+  public:
+    constexpr IntrusivePtr() noexcept : ptr_(nullptr) {}
+
+    constexpr IntrusivePtr(std::nullptr_t) noexcept : ptr_(nullptr) {}
+
+    // Takes a new reference to the object, add_ref = false adopts one the caller already holds
+    explicit IntrusivePtr(T* ptr, bool add_ref = true) noexcept : ptr_(ptr) {
+        if (ptr_ != nullptr && add_ref) {
+            intrusive_add_ref(ptr_);
+        }
+    }
+
+    IntrusivePtr(const IntrusivePtr& other) noexcept : ptr_(other.ptr_) {
+        if (ptr_ != nullptr) {
+            intrusive_add_ref(ptr_);
+        }
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    IntrusivePtr(const IntrusivePtr<U>& other) noexcept : ptr_(other.ptr_) {
+        if (ptr_ != nullptr) {
+            intrusive_add_ref(ptr_);
+        }
+    }
+
+    IntrusivePtr(IntrusivePtr&& other) noexcept : ptr_(std::exchange(other.ptr_, nullptr)) {}
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    IntrusivePtr(IntrusivePtr<U>&& other) noexcept : ptr_(std::exchange(other.ptr_, nullptr)) {}
+
+    ~IntrusivePtr() noexcept {
+        if (ptr_ != nullptr) {
+            intrusive_release(ptr_);
+        }
+    }
+
+    IntrusivePtr& operator=(const IntrusivePtr& other) noexcept {
+        IntrusivePtr(other).swap(*this);
+        return *this;
+    }
+
+    IntrusivePtr& operator=(IntrusivePtr&& other) noexcept {
+        IntrusivePtr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    void swap(IntrusivePtr& other) noexcept {
+        std::swap(ptr_, other.ptr_);
+    }
+
+    void reset(T* new_ptr = nullptr) noexcept {
+        IntrusivePtr(new_ptr).swap(*this);
+    }
+
+    // Gives up ownership without touching the count, the caller now holds the reference
+    T* detach() noexcept {
+        return std::exchange(ptr_, nullptr);
+    }
+
+    T* get() const noexcept {
+        return ptr_;
+    }
+
+    explicit operator bool() const noexcept {
+        return ptr_ != nullptr;
+    }
+
+    size_t use_count() const noexcept {
+        return ptr_ ? ptr_->use_count() : 0;
+    }
+
+    bool unique() const noexcept {
+        return use_count() == 1;
+    }
+
+    T& operator*() const {
+        if (!ptr_) {
+            throw std::runtime_error("Attempt to deref a nullptr");
+        }
+        return *ptr_;
+    }
+
+    T* operator->() const noexcept {
+        return ptr_;
+    }
+
+    bool operator==(std::nullptr_t) const noexcept {
+        return ptr_ == nullptr;
+    }
+
+    template <typename U>
+    bool operator==(const IntrusivePtr<U>& other) const noexcept {
+        return ptr_ == other.get();
+    }
+};
+
+template <typename T, typename... Args>
+IntrusivePtr<T> make_intrusive(Args&&... args) {
+    return IntrusivePtr<T>(new T(std::forward<Args>(args)...));
+}
+}  // namespace ds::smart_ptrs
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <thread>
+
+namespace ds::smart_ptrs {
+
+// Reference counter policies
+//
+// AtomicCounter may be shared between threads, PlainCounter is a plain integer for objects
+// confined to one thread (or one fiber): an increment is a single add instead of a locked RMW
+//
+// Both are used by RefCounted / IntrusivePtr and by the control blocks of SharedPtr / WeakPtr
+
+class AtomicCounter {
+  private:
+    std::atomic<int> count_;
+
+  public:
+    explicit AtomicCounter(int initial = 0) noexcept : count_(initial) {}
+
+    // a new reference is always made from an existing one, so it doesn't need to synchronize
+    void increment(int n = 1) noexcept {
+        count_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    // Returns true if these were the last references
+    // acq_rel orders every use of the object before its destruction
+    bool decrement(int n = 1) noexcept {
+        return count_.fetch_sub(n, std::memory_order_acq_rel) == n;
+    }
+
+    int load() const noexcept {
+        return count_.load(std::memory_order_acquire);
+    }
+
+    // Increments unless the count already dropped to zero (WeakPtr::lock)
+    bool try_increment() noexcept {
+        int old_count = count_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            if (old_count == 0) {  // hence object is already destroyed
+                return false;
+            }
+
+            // atomically try to increment and if old_count has changed => loop again
+            if (count_.compare_exchange_weak(old_count, old_count + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+};
+
+// Debug builds remember the thread that created the counter and assert that every operation
+// comes from it. A fiber that may resume on another pool worker counts as another thread here
+class PlainCounter {
+  private:
+    int count_;
+
+#ifndef NDEBUG
+    std::thread::id owner_ = std::this_thread::get_id();
+#endif
+
+    void check_owner() const noexcept {
+#ifndef NDEBUG
+        assert(owner_ == std::this_thread::get_id() && "PlainCounter used from more than one thread");
+#endif
+    }
+
+  public:
+    explicit PlainCounter(int initial = 0) noexcept : count_(initial) {}
+
+    void increment(int n = 1) noexcept {
+        check_owner();
+        count_ += n;
+    }
+
+    bool decrement(int n = 1) noexcept {
+        check_owner();
+        return (count_ -= n) == 0;
+    }
+
+    int load() const noexcept {
+        check_owner();
+        return count_;
+    }
+
+    bool try_increment() noexcept {
+        check_owner();
+        if (count_ == 0) {
+            return false;
+        }
+        ++count_;
+        return true;
+    }
+};
+}  // namespace ds::smart_ptrs
@@ -8,13 +8,17 @@
 namespace ds::smart_ptrs {
 
 template <typename T>
-class WeakPtr;
+class AtomicSharedPtr;
 
-template <typename T>
+// Counter selects atomic (default) or plain reference counts, see RefCount.hpp
+// SharedPtr<T, PlainCounter> (LocalSharedPtr) is a cheap Rc-style pointer for single-threaded object graphs
+template <typename T, typename Counter>
 class SharedPtr {
   private:
+    using ControlBlock = BaseControlBlock<Counter>;
+
     T* ptr_;
-    BaseControlBlock* ctr_block_;
+    ControlBlock* ctr_block_;
 
   public:
     explicit SharedPtr() noexcept : ptr_(nullptr), ctr_block_(nullptr) {}
@@ -27,16 +31,17 @@ class SharedPtr {
         }
 
         try {
-            ctr_block_ = new DefaultControlBlock<T>(ptr_);
+            ctr_block_ = new DefaultControlBlock<T, Counter>(ptr_);
         } catch (...) {
             delete ptr_;  // preventing leaks if control block alloc fails
             throw;
         }
     }
 
+    // other already holds a reference, so the count can't be zero: a plain increment is enough
     SharedPtr(const SharedPtr& other) noexcept : ptr_(other.ptr_), ctr_block_(other.ctr_block_) {
         if (ctr_block_) {
-            ctr_block_->try_increment_shared();
+            ctr_block_->increment_shared();
         }
     }
 
@@ -46,7 +51,7 @@ class SharedPtr {
     // Constructor from WeakPtr::lock()
     // Tries to acquire a shared ownership from a weak_ptr
     // and if successfull => construct a valid SharedPtr. otherwise, an empty one
-    SharedPtr(const WeakPtr<T>& weak) : ptr_(weak.ptr_), ctr_block_(weak.ctr_block_) {
+    SharedPtr(const WeakPtr<T, Counter>& weak) : ptr_(weak.ptr_), ctr_block_(weak.ctr_block_) {
         // if weak_ptr is null or expired => ctr_block might be nullptr
         // or if it points to a control block  but the obj is already deleted (shared_count_ == 0)
         if (ctr_block_ && ctr_block_->try_increment_shared()) {
@@ -121,10 +126,13 @@ class SharedPtr {
         swap(temp);
     }
 
-    friend class WeakPtr<T>;
+    friend class WeakPtr<T, Counter>;
+
+    template <typename U>
+    friend class AtomicSharedPtr;
 
-    template <typename U, typename... Args>
-    friend SharedPtr<U> make_shared(Args&&... args);
+    template <typename U, typename C, typename Allocator, typename... Args>
+    friend SharedPtr<U, C> allocate_shared(const Allocator& alloc, Args&&... args);
 
   private:
     void release() noexcept {
@@ -132,39 +140,50 @@ class SharedPtr {
             return;
         }
 
-        if (ctr_block_->decrement_shared()) {
-            ctr_block_->destroy_obj();
-
-            if (ctr_block_->decrement_weak()) {
-                ctr_block_->destroy_self();
-            }
-        }
+        ctr_block_->release_shared();
     }
 
-    SharedPtr(T* ptr, BaseControlBlock* cb) noexcept : ptr_(ptr), ctr_block_(cb) {}
+    SharedPtr(T* ptr, ControlBlock* cb) noexcept : ptr_(ptr), ctr_block_(cb) {}
 };
 
-template <typename T, typename... Args>
-SharedPtr<T> make_shared(Args&&... args) {
-    MakeSharedControlBlock<T>* cb = nullptr;  // the object T will be constructed inside it
+template <typename T>
+using LocalSharedPtr = SharedPtr<T, PlainCounter>;
 
-    try {
-        cb = new MakeSharedControlBlock<T>(std::forward<Args>(args)...);
+// Cheap to copy on the creating thread, still safe to share with others
+template <typename T>
+using BiasedSharedPtr = SharedPtr<T, BiasedCounter>;
 
-        return SharedPtr<T>(cb->get_object(), cb);
-    } catch (...) {
-        delete cb;
-        throw;
-    }
+// Creates the object and its control block in a single allocation made through alloc
+template <typename T, typename Counter = AtomicCounter, typename Allocator, typename... Args>
+SharedPtr<T, Counter> allocate_shared(const Allocator& alloc, Args&&... args) {
+    auto* cb = AllocateSharedControlBlock<T, Allocator, Counter>::create(alloc, std::forward<Args>(args)...);
+    return SharedPtr<T, Counter>(cb->get_object(), cb);
 }
 
-template <typename T>
-bool operator==(std::nullptr_t, const SharedPtr<T>& ptr) noexcept {
+// Fused allocation from the thread-caching control block pool
+template <typename T, typename Counter = AtomicCounter, typename... Args>
+SharedPtr<T, Counter> make_shared(Args&&... args) {
+    return smart_ptrs::allocate_shared<T, Counter>(ControlBlockAllocator<T>(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename... Args>
+LocalSharedPtr<T> make_local_shared(Args&&... args) {
+    return smart_ptrs::make_shared<T, PlainCounter>(std::forward<Args>(args)...);
+}
+
+// The calling thread becomes the owner of the count
+template <typename T, typename... Args>
+BiasedSharedPtr<T> make_biased_shared(Args&&... args) {
+    return smart_ptrs::make_shared<T, BiasedCounter>(std::forward<Args>(args)...);
+}
+
+template <typename T, typename Counter>
+bool operator==(std::nullptr_t, const SharedPtr<T, Counter>& ptr) noexcept {
     return ptr == nullptr;
 }
 
-template <typename T>
-bool operator!=(std::nullptr_t, const SharedPtr<T>& ptr) noexcept {
+template <typename T, typename Counter>
+bool operator!=(std::nullptr_t, const SharedPtr<T, Counter>& ptr) noexcept {
     return ptr != nullptr;
 }
 }  // namespace ds::smart_ptrs
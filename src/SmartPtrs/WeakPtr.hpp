@@ -6,21 +6,22 @@
 
 namespace ds::smart_ptrs {
 
-template <typename T>
+// Counter must match the SharedPtr it observes
+template <typename T, typename Counter>
 class WeakPtr {
   private:
     T* ptr_;
-    BaseControlBlock* ctr_block_;
+    BaseControlBlock<Counter>* ctr_block_;
 
     // friend shared_ptr so it can access private members for construction from weak_ptr
-    friend class SharedPtr<T>;
+    friend class SharedPtr<T, Counter>;
 
   public:
     // creates an empty weak_ptr
     constexpr WeakPtr() noexcept : ptr_(nullptr), ctr_block_(nullptr) {}
 
     // constructor from shared_ptr (observes its state)
-    WeakPtr(const SharedPtr<T>& shared) noexcept : ptr_(shared.ptr_), ctr_block_(shared.ctr_block_) {
+    WeakPtr(const SharedPtr<T, Counter>& shared) noexcept : ptr_(shared.ptr_), ctr_block_(shared.ctr_block_) {
         if (ctr_block_) {
             ctr_block_->increment_weak();
         }
@@ -58,7 +59,7 @@ class WeakPtr {
         return *this;
     }
 
-    WeakPtr& operator=(const SharedPtr<T>& shared) noexcept {
+    WeakPtr& operator=(const SharedPtr<T, Counter>& shared) noexcept {
         release();
 
         ptr_ = shared.ptr_;
@@ -73,16 +74,16 @@ class WeakPtr {
 
     // Attempt to acquire a shared_ptr from this weak_ptr
     // returns a valid shared_ptr if the obj is still alive, otherwise an empty shared_ptr
-    SharedPtr<T> lock() const noexcept {
+    SharedPtr<T, Counter> lock() const noexcept {
         if (ctr_block_ == nullptr) {
-            return SharedPtr<T>();  // empty weak_ptr cannot be locked
+            return SharedPtr<T, Counter>();  // empty weak_ptr cannot be locked
         }
 
         // use try_increment_shared from control block to atomically acquire the ownership
         if (ctr_block_->try_increment_shared()) {
-            return SharedPtr<T>(ptr_, ctr_block_);
+            return SharedPtr<T, Counter>(ptr_, ctr_block_);
         } else {
-            return SharedPtr<T>();  // object has expired (shared_count became 0)
+            return SharedPtr<T, Counter>();  // object has expired (shared_count became 0)
         }
     }
 
@@ -106,15 +107,17 @@ class WeakPtr {
             return;
         }
 
-        // decrement weak count. if it was the last weak reference => consider destroying the control block
-        bool weak_cnt = ctr_block_->decrement_weak();
-
-        if (weak_cnt && ctr_block_->use_count() == 0) {
-            ctr_block_->destroy_self();
-        }
+        // if it was the last weak reference and no SharedPtr is left, the control block is destroyed
+        ctr_block_->release_weak();
 
         ptr_ = nullptr;
         ctr_block_ = nullptr;
     }
 };
+
+template <typename T>
+using LocalWeakPtr = WeakPtr<T, PlainCounter>;
+
+template <typename T>
+using BiasedWeakPtr = WeakPtr<T, BiasedCounter>;
 }  // namespace ds::smart_ptrs
@@ -0,0 +1,123 @@
+#include "../src/Containers/BitArray.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using BitArray = ds::containers::BitArray;
+using RankSelectIndex = ds::containers::RankSelectIndex;
+
+TEST(BitArrayTest, SetTestAndCount) {
+    BitArray bits(200);
+    EXPECT_EQ(bits.size(), 200);
+    EXPECT_EQ(bits.count(), 0);
+    EXPECT_TRUE(bits.none());
+
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(199);
+    EXPECT_EQ(bits.count(), 4);
+    EXPECT_TRUE(bits[63]);
+    EXPECT_FALSE(bits[62]);
+
+    bits.reset(63);
+    bits.flip(62);
+    EXPECT_FALSE(bits.test(63));
+    EXPECT_TRUE(bits.test(62));
+    EXPECT_THROW(bits.test(200), std::out_of_range);
+
+    BitArray ones(130, true);
+    EXPECT_EQ(ones.count(), 130);
+    EXPECT_TRUE(ones.all());
+}
+
+TEST(BitArrayTest, PushResizeAndFlipKeepTailClear) {
+    BitArray bits;
+    for (int i = 0; i < 70; ++i) {
+        bits.push_back(i % 2 == 0);
+    }
+    EXPECT_EQ(bits.size(), 70);
+    EXPECT_EQ(bits.count(), 35);
+
+    bits.flip_all();
+    EXPECT_EQ(bits.count(), 35);
+
+    bits.resize(100, true);
+    EXPECT_EQ(bits.count(), 65);
+
+    bits.resize(65);
+    EXPECT_EQ(bits.count(), 32);
+
+    bits.pop_back();
+    EXPECT_EQ(bits.size(), 64);
+    EXPECT_EQ(bits.count(), 32);
+}
+
+TEST(BitArrayTest, FindFirstAndNext) {
+    BitArray bits(1000);
+    EXPECT_EQ(bits.find_first(), BitArray::npos);
+
+    std::vector<size_t> expected = {3, 64, 65, 500, 999};
+    for (size_t i : expected) {
+        bits.set(i);
+    }
+
+    std::vector<size_t> found;
+    for (size_t i = bits.find_first(); i != BitArray::npos; i = bits.find_next(i)) {
+        found.push_back(i);
+    }
+    EXPECT_EQ(found, expected);
+}
+
+TEST(BitArrayTest, BulkOperations) {
+    BitArray a(100);
+    BitArray b(100);
+    for (size_t i = 0; i < 100; i += 2) {
+        a.set(i);
+    }
+    for (size_t i = 0; i < 100; i += 3) {
+        b.set(i);
+    }
+
+    EXPECT_EQ((a & b).count(), 17);
+    EXPECT_EQ((a | b).count(), 67);
+    EXPECT_EQ((a ^ b).count(), 50);
+    EXPECT_EQ((~a).count(), 50);
+
+    BitArray c(a);
+    c.subtract(b);
+    EXPECT_EQ(c.count(), 33);
+    EXPECT_EQ(c, a ^ (a & b));
+
+    BitArray other(10);
+    EXPECT_THROW(a &= other, std::invalid_argument);
+}
+
+TEST(BitArrayTest, RankSelect) {
+    std::mt19937 gen(42);
+    BitArray bits(5000);
+    std::vector<size_t> ones;
+    for (size_t i = 0; i < bits.size(); ++i) {
+        if (gen() % 5 == 0) {
+            bits.set(i);
+            ones.push_back(i);
+        }
+    }
+
+    RankSelectIndex index(bits);
+    EXPECT_EQ(index.total_ones(), ones.size());
+
+    size_t rank = 0;
+    for (size_t i = 0; i <= bits.size(); ++i) {
+        ASSERT_EQ(index.rank1(i), rank);
+        if (i < bits.size() && bits[i]) {
+            ++rank;
+        }
+    }
+
+    for (size_t k = 0; k < ones.size(); ++k) {
+        ASSERT_EQ(index.select1(k), ones[k]);
+    }
+    EXPECT_EQ(index.select1(ones.size()), BitArray::npos);
+    EXPECT_EQ(index.rank0(100), 100 - index.rank1(100));
+}
@@ -0,0 +1,253 @@
+#include "../src/Containers/ArraySlice.hpp"
+#include "../src/Containers/DynamicArray.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+template <typename T>
+using DynamicArray = ds::containers::DynamicArray<T>;
+
+class DynamicArrayTest : public ::testing::Test {
+  protected:
+    DynamicArray<int> arr;
+    DynamicArray<std::string> str_arr;
+
+    void SetUp() override {
+        for (int i = 0; i < 10; ++i) {
+            arr.push_back(i);
+            str_arr.push_back(std::to_string(i));
+        }
+    }
+};
+
+TEST_F(DynamicArrayTest, EraseValue) {
+    arr.push_back(3);
+    arr.push_back(3);
+    arr.erase(3);
+
+    EXPECT_EQ(arr.size(), 9);
+    for (const auto& item : arr) {
+        EXPECT_NE(item, 3);
+    }
+}
+
+TEST_F(DynamicArrayTest, EraseIf) {
+    size_t removed = arr.erase_if([](int x) {
+        return x % 2 == 0;
+    });
+
+    EXPECT_EQ(removed, 5);
+    ASSERT_EQ(arr.size(), 5);
+    for (size_t i = 0; i < arr.size(); ++i) {
+        EXPECT_EQ(arr[i], static_cast<int>(2 * i + 1));
+    }
+
+    size_t str_removed = str_arr.erase_if([](const std::string& s) {
+        return s < "5";
+    });
+
+    EXPECT_EQ(str_removed, 5);
+    ASSERT_EQ(str_arr.size(), 5);
+    EXPECT_EQ(str_arr.front(), "5");
+    EXPECT_EQ(str_arr.back(), "9");
+}
+
+TEST_F(DynamicArrayTest, EraseIfCallsPredicateOncePerElement) {
+    // stateful predicate: removes every third element it is shown
+    size_t calls = 0;
+    size_t removed = arr.erase_if([&calls](int) {
+        return ++calls % 3 == 0;
+    });
+
+    EXPECT_EQ(calls, 10);
+    EXPECT_EQ(removed, 3);
+    const int expected[] = {0, 1, 3, 4, 6, 7, 9};
+    ASSERT_EQ(arr.size(), 7);
+    for (size_t i = 0; i < arr.size(); ++i) {
+        EXPECT_EQ(arr[i], expected[i]);
+    }
+}
+
+TEST_F(DynamicArrayTest, EraseIfThrowingPredicateKeepsArrayValid) {
+    // long enough to live on the heap, so a slot destroyed twice is a double free
+    const std::string padding(32, 'x');
+    DynamicArray<std::string> long_arr;
+    for (int i = 0; i < 10; ++i) {
+        long_arr.push_back(padding + std::to_string(i));
+    }
+
+    int calls = 0;
+    auto throw_on_fourth = [&](const std::string& s) {
+        if (++calls == 4) {
+            throw std::runtime_error("predicate failed");
+        }
+        return s == padding + "2";  // the last element seen before the throw is a removed one
+    };
+    EXPECT_THROW(long_arr.erase_if(throw_on_fourth), std::runtime_error);
+
+    // nothing was destroyed: every slot is still a live string
+    ASSERT_EQ(long_arr.size(), 10);
+    EXPECT_EQ(long_arr[0], padding + "0");
+    EXPECT_EQ(long_arr[1], padding + "1");
+    EXPECT_EQ(long_arr[2], padding + "2");
+    EXPECT_EQ(long_arr[9], padding + "9");
+
+    calls = 0;
+    auto equal_throw_on_fourth = [&calls](const std::string& a, const std::string& b) {
+        if (++calls == 4) {
+            throw std::runtime_error("predicate failed");
+        }
+        return a == b;
+    };
+    long_arr[3] = long_arr[2];  // removed by the third comparison, right before the throwing one
+    EXPECT_THROW(long_arr.remove_duplicates(equal_throw_on_fourth), std::runtime_error);
+    EXPECT_EQ(long_arr.size(), 10);
+}
+
+TEST_F(DynamicArrayTest, EraseRange) {
+    auto it = arr.erase(arr.begin() + 2, arr.begin() + 5);
+
+    EXPECT_EQ(*it, 5);
+    ASSERT_EQ(arr.size(), 7);
+    EXPECT_EQ(arr[1], 1);
+    EXPECT_EQ(arr[2], 5);
+    EXPECT_EQ(arr.back(), 9);
+
+    auto str_it = str_arr.erase(str_arr.begin(), str_arr.begin() + 9);
+    EXPECT_EQ(*str_it, "9");
+    EXPECT_EQ(str_arr.size(), 1);
+
+    EXPECT_EQ(arr.erase(arr.begin(), arr.begin()), arr.begin());
+    EXPECT_EQ(arr.size(), 7);
+}
+
+TEST_F(DynamicArrayTest, RemoveDuplicates) {
+    DynamicArray<std::string> sorted;
+    for (const char* s : {"a", "a", "b", "c", "c", "c", "d"}) {
+        sorted.push_back(s);
+    }
+
+    EXPECT_EQ(sorted.remove_duplicates(), 3);
+    ASSERT_EQ(sorted.size(), 4);
+    EXPECT_EQ(sorted[0], "a");
+    EXPECT_EQ(sorted[1], "b");
+    EXPECT_EQ(sorted[2], "c");
+    EXPECT_EQ(sorted[3], "d");
+
+    EXPECT_EQ(arr.remove_duplicates(), 0);
+}
+
+TEST_F(DynamicArrayTest, SwapAndPop) {
+    arr.swap_and_pop(2);
+
+    ASSERT_EQ(arr.size(), 9);
+    EXPECT_EQ(arr[2], 9);
+    EXPECT_EQ(arr.back(), 8);
+
+    str_arr.swap_and_pop(str_arr.size() - 1);
+    EXPECT_EQ(str_arr.back(), "8");
+
+    EXPECT_THROW(arr.swap_and_pop(100), std::out_of_range);
+}
+
+TEST_F(DynamicArrayTest, ResizeForOverwrite) {
+    arr.resize_for_overwrite(20);
+    EXPECT_EQ(arr.size(), 20);
+    EXPECT_EQ(arr[9], 9);
+
+    arr.resize_for_overwrite(5);
+    EXPECT_EQ(arr.size(), 5);
+    EXPECT_EQ(arr.back(), 4);
+
+    str_arr.resize_for_overwrite(12);
+    EXPECT_TRUE(str_arr.back().empty());
+}
+
+TEST_F(DynamicArrayTest, AppendUninitialized) {
+    auto tail = arr.append_uninitialized(3);
+    ASSERT_EQ(tail.size(), 3);
+    for (size_t i = 0; i < tail.size(); ++i) {
+        tail[i] = 100 + static_cast<int>(i);
+    }
+
+    ASSERT_EQ(arr.size(), 13);
+    EXPECT_EQ(arr[9], 9);
+    EXPECT_EQ(arr[10], 100);
+    EXPECT_EQ(arr.back(), 102);
+}
+
+TEST_F(DynamicArrayTest, AppendFromCallback) {
+    size_t appended = arr.append_from([](int* dst, size_t max_count) {
+        EXPECT_EQ(max_count, 8);
+        for (size_t i = 0; i < 4; ++i) {
+            dst[i] = -1;
+        }
+        return size_t{4};
+    }, 8);
+
+    EXPECT_EQ(appended, 4);
+    EXPECT_EQ(arr.size(), 14);
+    EXPECT_EQ(arr.back(), -1);
+
+    EXPECT_THROW(arr.append_from([](int*, size_t) -> size_t {
+        throw std::runtime_error("producer failed");
+    }, 8), std::runtime_error);
+    EXPECT_EQ(arr.size(), 14);
+}
+
+TEST_F(DynamicArrayTest, AppendFromFd) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+
+    const std::string payload = "hello, pipe";
+    ASSERT_EQ(write(fds[1], payload.data(), payload.size()), static_cast<ssize_t>(payload.size()));
+    close(fds[1]);
+
+    DynamicArray<char> buffer;
+    size_t total = 0;
+    while (size_t n = buffer.append_from(fds[0], 4)) {
+        total += n;
+    }
+    close(fds[0]);
+
+    EXPECT_EQ(total, payload.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.end()), payload);
+}
+
+TEST_F(DynamicArrayTest, FreezeDoesNotCopy) {
+    const int* raw = arr.cbegin();
+    auto buffer = ds::containers::freeze(std::move(arr));
+
+    EXPECT_TRUE(arr.empty());
+    EXPECT_EQ(buffer.data(), raw);
+    EXPECT_EQ(buffer.size(), 10);
+    EXPECT_EQ(buffer[3], 3);
+}
+
+TEST_F(DynamicArrayTest, SlicesShareBuffer) {
+    ds::containers::ArraySlice<std::string> tail;
+    {
+        auto buffer = ds::containers::freeze(std::move(str_arr));
+        auto middle = buffer.slice(2, 6);
+
+        ASSERT_EQ(middle.size(), 6);
+        EXPECT_EQ(middle.front(), "2");
+        EXPECT_EQ(middle.back(), "7");
+        EXPECT_EQ(middle.data(), buffer.data() + 2);
+
+        tail = middle.subslice(4);
+        EXPECT_EQ(buffer.use_count(), 3);
+        EXPECT_THROW(middle.subslice(3, 4), std::out_of_range);
+    }
+
+    // the slice outlives the buffer and keeps the storage alive
+    EXPECT_EQ(tail.use_count(), 1);
+    ASSERT_EQ(tail.size(), 2);
+    EXPECT_EQ(tail[0], "6");
+    EXPECT_EQ(tail.at(1), "7");
+
+    auto copy = tail.to_array();
+    EXPECT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy[1], "7");
+}
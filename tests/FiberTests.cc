@@ -3,8 +3,12 @@
 
 #include "../src/Concurrency/Fiber/Fiber.hpp"
 #include "Go.hpp"
+#include "Sleep.hpp"
+#include <atomic>
+#include <chrono>
 #include <gtest/gtest.h>
 #include <memory>
+#include <thread>
 
 using namespace ds::runtime;
 
@@ -38,6 +42,74 @@ TEST_F(FiberTest, SimpleExecution) {
     wg.wait();
 }
 
+TEST_F(FiberTest, SleepParksWithoutBlockingWorkers) {
+    WaitGroup wg;
+    std::atomic<int> woken{0};
+    const auto start = std::chrono::steady_clock::now();
+
+    // far more sleepers than workers: they can only overlap if sleeping doesn't hold a thread
+    wg.add(100);
+    for (int i = 0; i < 100; ++i) {
+        ds::fiber::go(*sched_, [&] {
+            ds::fiber::sleep_for(std::chrono::milliseconds(50));
+            EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+            woken.fetch_add(1);
+            wg.done();
+        });
+    }
+
+    wg.wait();
+    EXPECT_EQ(woken.load(), 100);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+}
+
+// Sleepers that already woke up are released together with their fibers
+TEST(FiberSleepTest, QuiescedSleepersAreReleasedByStop) {
+    Scheduler sched(2);
+    sched.start();
+
+    // every fiber owns a copy, released together with the fiber and its stack
+    auto token = std::make_shared<int>(0);
+    WaitGroup wg;
+    wg.add(20);
+    for (int i = 0; i < 20; ++i) {
+        ds::fiber::go(sched, [&wg, token, i] {
+            ds::fiber::sleep_for(std::chrono::milliseconds(1 + i % 5));
+            wg.done();
+        });
+    }
+
+    wg.wait();
+    sched.stop();
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+// stop() hands the still-armed wake-up to the pool instead of dropping it
+TEST(FiberSleepTest, StopResumesArmedSleepers) {
+    Scheduler sched(2);
+    sched.start();
+
+    auto token = std::make_shared<int>(0);
+    std::atomic<int> parked{0};
+    std::atomic<int> finished{0};
+    for (int i = 0; i < 10; ++i) {
+        ds::fiber::go(sched, [&parked, &finished, token] {
+            parked.fetch_add(1);
+            ds::fiber::sleep_for(std::chrono::hours(1));
+            // sleeping again while the pool stops must not strand the fiber either
+            ds::fiber::sleep_for(std::chrono::hours(1));
+            finished.fetch_add(1);
+        });
+    }
+
+    while (parked.load() != 10) {
+        std::this_thread::yield();
+    }
+    sched.stop();
+    EXPECT_EQ(finished.load(), 10);
+    EXPECT_EQ(token.use_count(), 1);
+}
+
 TEST_F(FiberTest, AfewSteps) {
 }
 
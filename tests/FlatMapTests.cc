@@ -0,0 +1,171 @@
+#include "../src/Containers/FlatMap.hpp"
+#include "../src/Containers/FlatSet.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+template <typename Key>
+using EytzingerSet = ds::containers::FlatSet<Key, std::less<Key>, ds::containers::EytzingerSearch<Key, std::less<Key>>>;
+
+template <typename Set>
+class FlatSetTest : public ::testing::Test {};
+
+using SetTypes = ::testing::Types<ds::containers::FlatSet<int>, EytzingerSet<int>>;
+TYPED_TEST_SUITE(FlatSetTest, SetTypes);
+
+TYPED_TEST(FlatSetTest, InsertFindErase) {
+    TypeParam set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.find(1), set.end());
+
+    EXPECT_TRUE(set.insert(5).second_);
+    EXPECT_TRUE(set.insert(1).second_);
+    EXPECT_TRUE(set.insert(3).second_);
+    EXPECT_FALSE(set.insert(3).second_);
+
+    ASSERT_EQ(set.size(), 3);
+    EXPECT_EQ(*set.begin(), 1);
+    EXPECT_TRUE(set.contains(3));
+    EXPECT_FALSE(set.contains(4));
+    EXPECT_EQ(*set.lower_bound(4), 5);
+    EXPECT_EQ(*set.upper_bound(3), 5);
+    EXPECT_EQ(set.upper_bound(5), set.end());
+
+    EXPECT_EQ(set.erase(3), 1);
+    EXPECT_EQ(set.erase(3), 0);
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_TRUE(set.contains(5));
+}
+
+TYPED_TEST(FlatSetTest, BatchInsertMatchesStdSet) {
+    std::mt19937 gen(7);
+    TypeParam set;
+    std::set<int> reference;
+
+    for (int round = 0; round < 5; ++round) {
+        std::vector<int> batch;
+        for (int i = 0; i < 300; ++i) {
+            batch.push_back(static_cast<int>(gen() % 1000));
+        }
+        set.insert(batch.begin(), batch.end());
+        reference.insert(batch.begin(), batch.end());
+
+        ASSERT_EQ(set.size(), reference.size());
+        EXPECT_TRUE(std::equal(set.begin(), set.end(), reference.begin()));
+    }
+
+    for (int key = -1; key <= 1001; ++key) {
+        ASSERT_EQ(set.contains(key), reference.count(key) == 1) << key;
+        auto it = set.lower_bound(key);
+        auto ref_it = reference.lower_bound(key);
+        ASSERT_EQ(it == set.end(), ref_it == reference.end());
+        if (ref_it != reference.end()) {
+            ASSERT_EQ(*it, *ref_it);
+        }
+    }
+}
+
+TYPED_TEST(FlatSetTest, Range) {
+    TypeParam set = {9, 1, 7, 3, 5};
+    auto [first, last] = set.range(2, 8);
+
+    std::vector<int> keys(first, last);
+    EXPECT_EQ(keys, (std::vector<int>{3, 5, 7}));
+}
+
+TEST(FlatMapTest, InsertAndLookup) {
+    ds::containers::FlatMap<std::string, int> map;
+
+    EXPECT_TRUE(map.insert("b", 2).second_);
+    EXPECT_TRUE(map.insert("a", 1).second_);
+    EXPECT_FALSE(map.insert("a", 100).second_);
+    map["c"] = 3;
+    map["a"] += 10;
+
+    ASSERT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at("a"), 11);
+    EXPECT_EQ(map.at("c"), 3);
+    EXPECT_THROW(map.at("z"), std::out_of_range);
+
+    map.insert_or_assign("b", 20);
+    EXPECT_EQ(map.find("b")->second, 20);
+
+    std::string keys;
+    for (auto entry : map) {
+        keys += entry.first;
+    }
+    EXPECT_EQ(keys, "abc");
+
+    EXPECT_EQ(map.erase("b"), 1);
+    EXPECT_FALSE(map.contains("b"));
+    EXPECT_EQ(map.size(), 2);
+}
+
+TEST(FlatMapTest, BatchInsertKeepsExistingValues) {
+    using Entry = ds::containers::Pair<int, std::string>;
+    ds::containers::FlatMap<int, std::string, std::less<int>, ds::containers::EytzingerSearch<int, std::less<int>>> map;
+    map.insert(2, "old");
+
+    std::vector<Entry> batch = {Entry(5, "five"), Entry(2, "new"), Entry(1, "one"), Entry(5, "dup")};
+    map.insert(batch.begin(), batch.end());
+
+    ASSERT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at(1), "one");
+    EXPECT_EQ(map.at(2), "old");
+    EXPECT_EQ(map.at(5), "five");
+    EXPECT_EQ(map.keys()[0], 1);
+    EXPECT_EQ(map.values()[2], "five");
+
+    auto [first, last] = map.range(2, 6);
+    map.erase(first, last);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_TRUE(map.contains(1));
+}
+
+TEST(FlatMapTest, SameKeyAndValueType) {
+    ds::containers::FlatMap<int, int> map;
+
+    EXPECT_TRUE(map.insert(1, 2).second_);
+    EXPECT_TRUE(map.insert(3, 4).second_);
+    EXPECT_FALSE(map.insert(1, 5).second_);
+
+    ASSERT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at(1), 2);
+    EXPECT_EQ(map.at(3), 4);
+}
+
+// Throws when the key 99 is moved into the map
+struct FragileKey {
+    int value;
+
+    explicit FragileKey(int v) : value(v) {}
+    FragileKey(const FragileKey&) = default;
+    FragileKey(FragileKey&& other) : value(other.value) {
+        if (value == 99) {
+            throw std::runtime_error("key move failed");
+        }
+    }
+    FragileKey& operator=(const FragileKey&) = default;
+    FragileKey& operator=(FragileKey&&) = default;
+
+    bool operator<(const FragileKey& other) const {
+        return value < other.value;
+    }
+};
+
+TEST(FlatMapTest, FailedKeyInsertKeepsArraysInStep) {
+    ds::containers::FlatMap<FragileKey, int> map;
+    map.insert(FragileKey(1), 1);
+    map.insert(FragileKey(2), 2);
+
+    EXPECT_THROW(map.insert(FragileKey(99), 99), std::runtime_error);
+    ASSERT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at(FragileKey(1)), 1);
+    EXPECT_EQ(map.at(FragileKey(2)), 2);
+
+    map.insert(FragileKey(3), 3);
+    EXPECT_EQ(map.keys()[2].value, 3);
+    EXPECT_EQ(map.values()[2], 3);
+}
@@ -0,0 +1,481 @@
+#include "../src/Containers/BinaryHeap.hpp"
+#include "../src/Containers/CalendarQueue.hpp"
+#include "../src/Containers/IndexedPriorityQueue.hpp"
+#include "../src/Containers/MinMaxHeap.hpp"
+#include "../src/Containers/PriorityQueue.hpp"
+#include "../src/Containers/RadixHeap.hpp"
+#include "../src/Containers/TopK.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <deque>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T, size_t Arity = 2>
+using BinaryHeap = ds::containers::BinaryHeap<T, Arity>;
+
+template <typename T, size_t Arity = 2>
+using PriorityQueue = ds::containers::PriorityQueue<T, ds::containers::DynamicArray<ds::containers::PriorityNode<T>, ds::containers::HeapAllocator<ds::containers::PriorityNode<T>>>,
+                                                    std::less<ds::containers::PriorityNode<T>>, Arity>;
+
+template <typename T>
+using MinIndexedQueue = ds::containers::IndexedPriorityQueue<T, std::greater<ds::containers::PriorityNode<T>>>;
+
+template <size_t Arity>
+void check_sorts_random_input() {
+    std::mt19937 gen(Arity);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+
+    BinaryHeap<int, Arity> heap;
+    std::vector<int> expected;
+    for (int i = 0; i < 5000; ++i) {
+        const int value = dist(gen);
+        heap.insert(value);
+        expected.push_back(value);
+
+        // interleave removals so sift_down runs on heaps of every shape
+        if (i % 7 == 0) {
+            const auto min_it = std::min_element(expected.begin(), expected.end());
+            ASSERT_EQ(heap.extract_min(), *min_it);
+            expected.erase(min_it);
+        }
+    }
+
+    std::sort(expected.begin(), expected.end());
+    for (int value : expected) {
+        ASSERT_EQ(heap.extract_min(), value);
+    }
+    EXPECT_TRUE(heap.empty());
+    EXPECT_THROW(heap.extract_min(), std::runtime_error);
+}
+
+TEST(BinaryHeapTest, SortsForEveryArity) {
+    check_sorts_random_input<2>();
+    check_sorts_random_input<3>();
+    check_sorts_random_input<4>();
+    check_sorts_random_input<8>();
+}
+
+TEST(BinaryHeapTest, SetElementRestoresOrder) {
+    BinaryHeap<std::string, 4> heap;
+    for (const char* word : {"pear", "fig", "kiwi", "apple", "plum", "lime", "date"}) {
+        heap.insert(std::string(word));
+    }
+    EXPECT_EQ(heap.get_element(0), "apple");
+
+    heap.set_element(heap.size() - 1, "banana");
+    EXPECT_EQ(heap.get_element(0), "apple");
+    heap.set_element(0, "zucchini");
+    EXPECT_THROW(heap.set_element(heap.size(), "x"), std::out_of_range);
+
+    std::vector<std::string> order;
+    while (!heap.empty()) {
+        order.push_back(heap.extract_min());
+    }
+    EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+    EXPECT_EQ(order.front(), "banana");
+    EXPECT_EQ(order.back(), "zucchini");
+}
+
+TEST(BinaryHeapTest, BulkConstructionAndPushRange) {
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int> dist(-100000, 100000);
+
+    std::vector<int> expected(20000);
+    for (auto& value : expected) {
+        value = dist(gen);
+    }
+
+    BinaryHeap<int, 4> heap(expected.begin(), expected.begin() + 10000);
+    heap.push_range(expected.begin() + 10000, expected.begin() + 10010);  // small batch: sift-ups
+    heap.push_range(expected.begin() + 10010, expected.end());           // large batch: rebuild
+    ASSERT_EQ(heap.size(), expected.size());
+
+    std::sort(expected.begin(), expected.end());
+    for (int value : expected) {
+        ASSERT_EQ(heap.extract_min(), value);
+    }
+
+    ds::containers::DynamicArray<int> elements;
+    for (int i = 100; i > 0; --i) {
+        elements.push_back(i);
+    }
+    BinaryHeap<int> from_array(std::move(elements));
+    for (int i = 1; i <= 100; ++i) {
+        ASSERT_EQ(from_array.extract_min(), i);
+    }
+}
+
+TEST(BinaryHeapTest, ChildrenShareCacheLine) {
+    ds::containers::HeapAllocator<uint64_t> alloc;
+    uint64_t* data = alloc.allocate(1000);
+    // children of node i in an 8-ary heap: 8 * i + 1 ... 8 * i + 8
+    for (size_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(data + 8 * i + 1) % 64, 0);
+    }
+    alloc.deallocate(data, 1000);
+}
+
+TEST(PriorityQueueTest, HighestPriorityFirst) {
+    PriorityQueue<std::string, 4> queue{{3, "c"}, {10, "j"}, {1, "a"}, {7, "g"}};
+    queue.push(5, "e");
+    queue.push(12, "l");
+    EXPECT_EQ(queue.top().item, "l");
+
+    PriorityQueue<std::string, 4> other;
+    other.push(8, "h");
+    other.push(2, "b");
+    queue.merge(other);
+    EXPECT_TRUE(other.empty());
+
+    std::string order;
+    while (!queue.empty()) {
+        order += queue.extract_min();
+    }
+    EXPECT_EQ(order, "ljhgecba");
+    EXPECT_THROW(queue.pop(), std::runtime_error);
+}
+
+TEST(PriorityQueueTest, NonContiguousContainer) {
+    using Node = ds::containers::PriorityNode<int>;
+    ds::containers::PriorityQueue<int, std::deque<Node>, std::less<Node>, 4> queue;
+    EXPECT_THROW(queue.pop(), std::runtime_error);
+
+    std::mt19937 rng(7);
+    std::vector<int> priorities;
+    for (int i = 0; i < 1000; ++i) {
+        const int priority = static_cast<int>(rng() % 500);
+        priorities.push_back(priority);
+        queue.push(priority, priority);
+    }
+
+    std::sort(priorities.rbegin(), priorities.rend());
+    for (int expected : priorities) {
+        ASSERT_EQ(queue.extract_min(), expected);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(IndexedPriorityQueueTest, UpdateAndEraseThroughHandles) {
+    MinIndexedQueue<std::string> queue;
+    auto a = queue.push(50, "a");
+    auto b = queue.push(40, "b");
+    auto c = queue.push(30, "c");
+    auto d = queue.push(20, "d");
+    EXPECT_EQ(queue.top_handle(), d);
+
+    queue.update(a, 10);  // decrease-key
+    EXPECT_EQ(queue.top_handle(), a);
+    queue.update(a, 60);  // increase-key
+    EXPECT_EQ(queue.top().item, "d");
+    EXPECT_EQ(queue.priority(a), 60);
+
+    EXPECT_TRUE(queue.erase(c));
+    EXPECT_FALSE(queue.contains(c));
+    EXPECT_FALSE(queue.erase(c));
+    EXPECT_THROW(queue.update(c, 1), std::out_of_range);
+
+    // the freed slot is reused, the old handle must stay invalid
+    auto e = queue.push(35, "e");
+    EXPECT_FALSE(queue.contains(c));
+    EXPECT_TRUE(queue.contains(e));
+    EXPECT_EQ(queue.item(e), "e");
+
+    std::string order;
+    while (!queue.empty()) {
+        order += queue.extract_min();
+    }
+    EXPECT_EQ(order, "deba");
+    EXPECT_FALSE(queue.contains(b));
+}
+
+TEST(IndexedPriorityQueueTest, Dijkstra) {
+    // random graph, checked against Bellman-Ford
+    const int n = 300;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> node(0, n - 1);
+    std::uniform_int_distribution<int> weight(1, 100);
+
+    struct Edge {
+        int from;
+        int to;
+        long weight;
+    };
+    std::vector<Edge> edges;
+    std::vector<std::vector<std::pair<int, long>>> adjacency(n);
+    for (int i = 0; i < 3000; ++i) {
+        Edge edge{node(gen), node(gen), weight(gen)};
+        edges.push_back(edge);
+        adjacency[edge.from].emplace_back(edge.to, edge.weight);
+    }
+
+    MinIndexedQueue<int> queue;
+    std::vector<MinIndexedQueue<int>::Handle> handles(n);
+    std::vector<long> dist(n, LONG_MAX);
+    std::vector<bool> done(n, false);
+    dist[0] = 0;
+    handles[0] = queue.push(0, 0);
+
+    while (!queue.empty()) {
+        const int u = queue.extract_min();
+        done[u] = true;
+        for (auto [v, w] : adjacency[u]) {
+            if (done[v] || dist[u] + w >= dist[v]) {
+                continue;
+            }
+            dist[v] = dist[u] + w;
+            if (queue.contains(handles[v])) {
+                queue.update(handles[v], dist[v]);
+            } else {
+                handles[v] = queue.push(dist[v], v);
+            }
+        }
+    }
+
+    std::vector<long> expected(n, LONG_MAX);
+    expected[0] = 0;
+    for (int round = 0; round < n; ++round) {
+        for (const auto& edge : edges) {
+            if (expected[edge.from] != LONG_MAX) {
+                expected[edge.to] = std::min(expected[edge.to], expected[edge.from] + edge.weight);
+            }
+        }
+    }
+    EXPECT_EQ(dist, expected);
+}
+
+// Dijkstra-like workload: every pushed priority is >= the last extracted one
+template <typename Queue>
+void check_monotone_workload(long spread) {
+    std::mt19937 gen(static_cast<unsigned>(spread));
+    std::uniform_int_distribution<long> step(0, spread);
+
+    Queue queue;
+    std::multimap<long, int> expected;
+    long last = -1'000'000;
+    int next_id = 0;
+
+    for (int round = 0; round < 20000; ++round) {
+        const int pushes = round % 3 == 0 ? 2 : 1;
+        for (int i = 0; i < pushes; ++i) {
+            const long priority = last + step(gen);
+            queue.push(priority, next_id);
+            expected.emplace(priority, next_id++);
+        }
+        if (round % 2 == 0 || round > 15000) {
+            if (expected.empty()) {
+                continue;
+            }
+            const long priority = queue.top().priority;
+            ASSERT_EQ(priority, expected.begin()->first);
+
+            // ties may come out in any order
+            const int id = queue.extract_min();
+            auto range = expected.equal_range(priority);
+            auto it = std::find_if(range.first, range.second, [id](const auto& entry) { return entry.second == id; });
+            ASSERT_NE(it, range.second);
+            expected.erase(it);
+            last = priority;
+        }
+    }
+
+    while (!expected.empty()) {
+        ASSERT_EQ(queue.top().priority, expected.begin()->first);
+        queue.pop();
+        expected.erase(expected.begin());
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_THROW(queue.extract_min(), std::runtime_error);
+}
+
+TEST(RadixHeapTest, MonotoneWorkload) {
+    check_monotone_workload<ds::containers::RadixHeap<int>>(10);
+    check_monotone_workload<ds::containers::RadixHeap<int>>(1'000'000'000);
+}
+
+TEST(RadixHeapTest, RejectsPrioritiesBelowLastExtracted) {
+    ds::containers::RadixHeap<std::string> heap;
+    heap.push(-5, "a");
+    heap.push(LONG_MAX, "z");
+    heap.push(LONG_MIN + 1, "first");
+    EXPECT_EQ(heap.extract_min(), "first");
+    heap.push(-6, "b");
+    EXPECT_EQ(heap.extract_min(), "b");
+    EXPECT_EQ(heap.extract_min(), "a");
+    EXPECT_THROW(heap.push(-6, "late"), std::invalid_argument);
+    EXPECT_EQ(heap.extract_min(), "z");
+
+    // once empty any priority is accepted again
+    heap.push(-100, "restart");
+    EXPECT_EQ(heap.top().item, "restart");
+}
+
+TEST(CalendarQueueTest, MonotoneWorkload) {
+    check_monotone_workload<ds::containers::CalendarQueue<int>>(10);
+    check_monotone_workload<ds::containers::CalendarQueue<int>>(1'000'000'000);
+}
+
+TEST(CalendarQueueTest, AcceptsOutOfOrderPriorities) {
+    ds::containers::CalendarQueue<long> queue;
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<long> dist(LONG_MIN, LONG_MAX);
+
+    std::vector<long> expected;
+    for (int i = 0; i < 3000; ++i) {
+        const long priority = dist(gen);
+        queue.push(priority, priority);
+        expected.push_back(priority);
+    }
+    EXPECT_GE(queue.bucket_count(), 1024);
+
+    std::sort(expected.begin(), expected.end());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(queue.extract_min(), expected[i]);
+        if (i % 100 == 0) {
+            queue.push(expected[i] - 1, expected[i] - 1);  // behind the cursor
+            ASSERT_EQ(queue.extract_min(), expected[i] - 1);
+        }
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(TopKTest, MatchesSortedPrefix) {
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> dist(0, 1'000'000);
+
+    std::vector<int> stream(100000);
+    for (auto& value : stream) {
+        value = dist(gen);
+    }
+
+    ds::containers::TopK<int> block_wise(100);
+    block_wise.push_range(stream.data(), stream.size());
+    ds::containers::TopK<int> one_by_one(100);
+    for (int value : stream) {
+        one_by_one.push(value);
+    }
+
+    std::sort(stream.begin(), stream.end(), std::greater<int>());
+    const auto blocks = block_wise.sorted();
+    const auto singles = one_by_one.sorted();
+    ASSERT_EQ(blocks.size(), 100);
+    ASSERT_EQ(singles.size(), 100);
+    for (size_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(blocks[i], stream[i]);
+        EXPECT_EQ(singles[i], stream[i]);
+    }
+    EXPECT_EQ(block_wise.threshold(), stream[99]);
+
+    ds::containers::TopK<int, std::greater<int>> smallest(3);
+    smallest.push_range(stream.begin(), stream.end());
+    EXPECT_EQ(smallest.sorted()[0], stream.back());
+
+    ds::containers::TopK<int> none(0);
+    none.push_range(stream.data(), stream.size());
+    EXPECT_TRUE(none.empty());
+    EXPECT_THROW(none.threshold(), std::runtime_error);
+}
+
+TEST(TopKTest, MergesPerThreadResults) {
+    constexpr size_t THREADS = 4;
+    constexpr size_t PER_THREAD = 50000;
+
+    std::vector<long> stream(THREADS * PER_THREAD);
+    std::mt19937 gen(8);
+    std::uniform_int_distribution<long> dist(LONG_MIN, LONG_MAX);
+    for (auto& value : stream) {
+        value = dist(gen);
+    }
+
+    std::vector<ds::containers::TopK<long>> partial(THREADS, ds::containers::TopK<long>(64));
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&, t] { partial[t].push_range(stream.data() + t * PER_THREAD, PER_THREAD); });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    ds::containers::TopK<long> total(64);
+    for (const auto& part : partial) {
+        total.merge(part);
+    }
+
+    std::sort(stream.begin(), stream.end(), std::greater<long>());
+    const auto result = total.sorted();
+    ASSERT_EQ(result.size(), 64);
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i], stream[i]);
+    }
+}
+
+TEST(MinMaxHeapTest, MatchesMultiset) {
+    std::mt19937 gen(21);
+    std::uniform_int_distribution<int> value(-500, 500);
+    std::uniform_int_distribution<int> op(0, 3);
+
+    ds::containers::MinMaxHeap<int> heap;
+    std::multiset<int> expected;
+    for (int i = 0; i < 20000; ++i) {
+        const int choice = op(gen);
+        if (choice <= 1 || expected.empty()) {
+            const int item = value(gen);
+            heap.push(item);
+            expected.insert(item);
+        } else if (choice == 2) {
+            ASSERT_EQ(heap.extract_min(), *expected.begin());
+            expected.erase(expected.begin());
+        } else {
+            ASSERT_EQ(heap.extract_max(), *expected.rbegin());
+            expected.erase(std::prev(expected.end()));
+        }
+
+        ASSERT_EQ(heap.size(), expected.size());
+        if (!expected.empty()) {
+            ASSERT_EQ(heap.min(), *expected.begin());
+            ASSERT_EQ(heap.max(), *expected.rbegin());
+        }
+    }
+}
+
+TEST(MinMaxHeapTest, BulkBuildAndBothEnds) {
+    std::vector<std::string> words = {"kiwi", "apple", "fig", "pear", "banana", "cherry", "date", "lime", "grape", "melon"};
+    ds::containers::MinMaxHeap<std::string> heap(words.begin(), words.end());
+    std::sort(words.begin(), words.end());
+
+    // drain from both ends towards the middle
+    size_t front = 0;
+    size_t back = words.size();
+    while (!heap.empty()) {
+        EXPECT_EQ(heap.min(), words[front]);
+        EXPECT_EQ(heap.max(), words[back - 1]);
+        if ((back - front) % 2 == 0) {
+            heap.pop_min();
+            ++front;
+        } else {
+            heap.pop_max();
+            --back;
+        }
+    }
+    EXPECT_THROW(heap.min(), std::runtime_error);
+    EXPECT_THROW(heap.pop_max(), std::runtime_error);
+
+    ds::containers::DynamicArray<int> numbers;
+    for (int i = 0; i < 1000; ++i) {
+        numbers.push_back((i * 7919) % 1000);
+    }
+    ds::containers::MinMaxHeap<int, std::greater<int>> reversed(std::move(numbers));
+    EXPECT_EQ(reversed.min(), 999);
+    EXPECT_EQ(reversed.max(), 0);
+    for (int i = 0; i < 500; ++i) {
+        ASSERT_EQ(reversed.extract_max(), i);
+        ASSERT_EQ(reversed.extract_min(), 999 - i);
+    }
+    EXPECT_TRUE(reversed.empty());
+}
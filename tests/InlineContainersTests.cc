@@ -0,0 +1,142 @@
+#include "../src/Containers/InlineQueue.hpp"
+#include "../src/Containers/InlineStack.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+using ds::containers::InlineOverflow;
+
+template <typename T, size_t N, InlineOverflow Policy = InlineOverflow::Assert>
+using InlineStack = ds::containers::InlineStack<T, N, Policy>;
+
+template <typename T, size_t N, InlineOverflow Policy = InlineOverflow::Assert>
+using InlineQueue = ds::containers::InlineQueue<T, N, Policy>;
+
+constexpr int stack_sum() {
+    InlineStack<int, 8> stack;
+    for (int i = 1; i <= 8; ++i) {
+        stack.push(i);
+    }
+    int sum = 0;
+    while (!stack.empty()) {
+        sum += stack.top();
+        stack.pop();
+    }
+    return sum;
+}
+
+constexpr int queue_order() {
+    InlineQueue<int, 3> queue;
+    int result = 0;
+    for (int round = 0; round < 4; ++round) {
+        queue.enqueue(round * 3 + 1);
+        queue.enqueue(round * 3 + 2);
+        queue.enqueue(round * 3 + 3);
+        while (!queue.empty()) {
+            result = result * 2 + (queue.front() % 2);
+            queue.dequeue();
+        }
+    }
+    return result;
+}
+
+TEST(InlineStackTest, UsableInConstantExpressions) {
+    static_assert(stack_sum() == 36);
+    static_assert(queue_order() == 0b101010101010);
+}
+
+TEST(InlineStackTest, RejectPolicy) {
+    InlineStack<std::string, 2, InlineOverflow::Reject> stack;
+    EXPECT_TRUE(stack.push("a"));
+    EXPECT_TRUE(stack.push("b"));
+    EXPECT_TRUE(stack.full());
+    EXPECT_FALSE(stack.push("c"));
+    EXPECT_EQ(stack.size(), 2);
+    EXPECT_EQ(stack.top(), "b");
+
+    stack.pop();
+    stack.pop();
+    EXPECT_TRUE(stack.empty());
+    EXPECT_THROW(stack.pop(), std::runtime_error);
+}
+
+TEST(InlineStackTest, SpillPolicy) {
+    InlineStack<std::string, 4, InlineOverflow::Spill> stack;
+    for (int i = 0; i < 10; ++i) {
+        stack.push(std::to_string(i));
+    }
+    EXPECT_TRUE(stack.on_heap());
+    EXPECT_FALSE(stack.full());
+    EXPECT_EQ(stack.size(), 10);
+    EXPECT_EQ(stack[2], "2");
+    EXPECT_EQ(stack[7], "7");
+
+    InlineStack<std::string, 4, InlineOverflow::Spill> copy(stack);
+    for (int i = 9; i >= 0; --i) {
+        EXPECT_EQ(stack.top(), std::to_string(i));
+        stack.pop();
+    }
+    EXPECT_TRUE(stack.empty());
+    EXPECT_FALSE(stack.on_heap());
+
+    InlineStack<std::string, 4, InlineOverflow::Spill> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 10);
+    EXPECT_EQ(moved.top(), "9");
+}
+
+TEST(InlineQueueTest, WrapsAroundInPlace) {
+    InlineQueue<std::string, 4> queue;
+    for (int i = 0; i < 100; ++i) {
+        queue.enqueue(std::to_string(i));
+        if (queue.full()) {
+            queue.dequeue();
+            queue.dequeue();
+        }
+    }
+    EXPECT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.front(), "98");
+    EXPECT_EQ(queue.back(), "99");
+
+    InlineQueue<std::string, 4> copy(queue);
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_THROW(queue.front(), std::runtime_error);
+    EXPECT_EQ(copy.front(), "98");
+}
+
+TEST(InlineQueueTest, RejectPolicy) {
+    InlineQueue<int, 2, InlineOverflow::Reject> queue;
+    EXPECT_TRUE(queue.enqueue(1));
+    EXPECT_TRUE(queue.enqueue(2));
+    EXPECT_FALSE(queue.enqueue(3));
+    queue.dequeue();
+    EXPECT_TRUE(queue.enqueue(3));
+    EXPECT_EQ(queue.front(), 2);
+    EXPECT_EQ(queue.back(), 3);
+}
+
+TEST(InlineQueueTest, SpillKeepsFifoOrder) {
+    InlineQueue<int, 4, InlineOverflow::Spill> queue;
+    int next_in = 0;
+    int next_out = 0;
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 7; ++i) {
+            queue.enqueue(next_in++);
+        }
+        EXPECT_EQ(queue.back(), next_in - 1);
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_EQ(queue.front(), next_out++);
+            queue.dequeue();
+        }
+    }
+    EXPECT_EQ(queue.size(), static_cast<size_t>(next_in - next_out));
+
+    InlineQueue<int, 4, InlineOverflow::Spill> moved;
+    moved = std::move(queue);
+    while (!moved.empty()) {
+        ASSERT_EQ(moved.front(), next_out++);
+        moved.dequeue();
+    }
+    EXPECT_EQ(next_out, next_in);
+    EXPECT_FALSE(moved.on_heap());
+}
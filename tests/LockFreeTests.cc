@@ -0,0 +1,309 @@
+#include "../src/Concurrency/LockFree/LockFreeStack.hpp"
+#include "../src/Concurrency/LockFree/MPMCQueue.hpp"
+#include "../src/Concurrency/LockFree/SPSCQueue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T>
+using SPSCQueue = ds::runtime::SPSCQueue<T>;
+
+template <typename T>
+using MPMCQueue = ds::runtime::MPMCQueue<T>;
+
+using OverflowPolicy = ds::runtime::OverflowPolicy;
+
+template <typename T>
+using LockFreeStack = ds::runtime::LockFreeStack<T>;
+
+TEST(SPSCQueueTest, BasicPushPop) {
+    SPSCQueue<std::string> queue(3);
+    EXPECT_EQ(queue.capacity(), 4);
+    EXPECT_FALSE(queue.try_pop().has_value());
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(std::to_string(i)));
+    }
+    EXPECT_FALSE(queue.try_push("overflow"));
+    EXPECT_EQ(queue.size_approx(), 4);
+
+    EXPECT_EQ(*queue.try_pop(), "0");
+    std::string out;
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(out, "1");
+
+    EXPECT_TRUE(queue.try_emplace(3, 'x'));
+    EXPECT_EQ(queue.size_approx(), 3);
+}
+
+TEST(SPSCQueueTest, BatchOperations) {
+    SPSCQueue<int> queue(8);
+    std::vector<int> input = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    EXPECT_EQ(queue.push_n(input.begin(), input.size()), 8);
+
+    std::vector<int> output(5);
+    EXPECT_EQ(queue.pop_n(output.begin(), 5), 5);
+    EXPECT_EQ(output, (std::vector<int>{0, 1, 2, 3, 4}));
+
+    // wraps around the end of the buffer
+    EXPECT_EQ(queue.push_n(input.begin() + 8, 2), 2);
+    std::vector<int> rest;
+    EXPECT_EQ(queue.pop_n(std::back_inserter(rest), 100), 5);
+    EXPECT_EQ(rest, (std::vector<int>{5, 6, 7, 8, 9}));
+    EXPECT_TRUE(queue.empty_approx());
+}
+
+TEST(SPSCQueueTest, DestroysRemainingItems) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        SPSCQueue<std::shared_ptr<int>> queue(16);
+        for (int i = 0; i < 10; ++i) {
+            queue.try_push(tracker);
+        }
+        queue.try_pop();
+        EXPECT_EQ(tracker.use_count(), 10);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(SPSCQueueTest, ProducerConsumerKeepOrder) {
+    constexpr int kItems = 1'000'000;
+    SPSCQueue<int> queue(1024);
+
+    std::thread producer([&] {
+        int batch[16];
+        int next = 0;
+        while (next < kItems) {
+            if (next % 3 == 0) {
+                if (queue.try_push(next)) {
+                    ++next;
+                }
+            } else {
+                int count = 0;
+                for (; count < 16 && next + count < kItems; ++count) {
+                    batch[count] = next + count;
+                }
+                next += static_cast<int>(queue.push_n(batch, count));
+            }
+        }
+    });
+
+    int expected = 0;
+    int batch[32];
+    while (expected < kItems) {
+        if (auto item = queue.try_pop()) {
+            ASSERT_EQ(*item, expected++);
+        }
+        size_t n = queue.pop_n(batch, 32);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(batch[i], expected++);
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(queue.empty_approx());
+}
+
+TEST(MPMCQueueTest, TryPushTryPop) {
+    MPMCQueue<std::string> queue(4);
+    EXPECT_FALSE(queue.try_pop().has_value());
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(std::to_string(i)));
+    }
+    EXPECT_FALSE(queue.try_push("overflow"));
+    EXPECT_EQ(queue.size_approx(), 4);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(*queue.try_pop(), std::to_string(i));
+    }
+    EXPECT_FALSE(queue.try_pop().has_value());
+}
+
+// Copies can fail (think bad_alloc), moves can't
+struct FallibleCopy {
+    static inline bool fail = false;
+    std::string value;
+
+    explicit FallibleCopy(std::string v) : value(std::move(v)) {}
+    FallibleCopy(const FallibleCopy& other) : value(other.value) {
+        if (fail) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    FallibleCopy(FallibleCopy&&) noexcept = default;
+};
+
+TEST(MPMCQueueTest, ThrowingCopyDoesNotStallTheQueue) {
+    MPMCQueue<FallibleCopy> queue(4);
+    const FallibleCopy item("item");
+
+    FallibleCopy::fail = true;
+    EXPECT_THROW(queue.try_push(item), std::runtime_error);
+    EXPECT_THROW(queue.push(item), std::runtime_error);
+    FallibleCopy::fail = false;
+
+    // the failed pushes claimed nothing
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(FallibleCopy(std::to_string(i))));
+    }
+    EXPECT_FALSE(queue.try_push(item));
+    for (int i = 0; i < 4; ++i) {
+        auto popped = queue.try_pop();
+        ASSERT_TRUE(popped.has_value());
+        EXPECT_EQ(popped->value, std::to_string(i));
+    }
+    EXPECT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(MPMCQueueTest, OverflowPolicies) {
+    MPMCQueue<int> reject(2, OverflowPolicy::Reject);
+    EXPECT_TRUE(reject.push(1));
+    EXPECT_TRUE(reject.push(2));
+    EXPECT_FALSE(reject.push(3));
+    EXPECT_EQ(*reject.try_pop(), 1);
+
+    MPMCQueue<int> drop(2, OverflowPolicy::DropOldest);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(drop.push(i));
+    }
+    EXPECT_EQ(*drop.try_pop(), 3);
+    EXPECT_EQ(*drop.try_pop(), 4);
+}
+
+TEST(MPMCQueueTest, CloseWakesBlockedThreads) {
+    MPMCQueue<int> queue(2);
+    queue.push(1);
+    queue.push(2);
+
+    std::thread producer([&] {
+        EXPECT_FALSE(queue.push(3));  // blocks on the full queue until close()
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    queue.close();
+    producer.join();
+
+    EXPECT_EQ(*queue.pop(), 1);
+    EXPECT_EQ(*queue.pop(), 2);
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(MPMCQueueTest, ManyProducersManyConsumers) {
+    constexpr int kProducers = 4;
+    constexpr int kConsumers = 4;
+    constexpr int kItemsPerProducer = 100'000;
+
+    MPMCQueue<int> queue(64);
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&] {
+            for (int i = 1; i <= kItemsPerProducer; ++i) {
+                ASSERT_TRUE(queue.push(i));
+            }
+        });
+    }
+    for (int c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            while (auto item = queue.pop()) {
+                sum.fetch_add(*item, std::memory_order_relaxed);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (int p = 0; p < kProducers; ++p) {
+        threads[p].join();
+    }
+    queue.close();
+    for (size_t t = kProducers; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+
+    EXPECT_EQ(consumed.load(), kProducers * kItemsPerProducer);
+    EXPECT_EQ(sum.load(), kProducers * (static_cast<long long>(kItemsPerProducer) * (kItemsPerProducer + 1) / 2));
+}
+
+TEST(LockFreeStackTest, LifoOrder) {
+    LockFreeStack<std::string> stack;
+    EXPECT_TRUE(stack.empty_approx());
+    EXPECT_FALSE(stack.try_pop().has_value());
+
+    stack.push("a");
+    stack.push("b");
+    stack.emplace(2, 'c');
+
+    EXPECT_EQ(*stack.try_pop(), "cc");
+    EXPECT_EQ(*stack.try_pop(), "b");
+    EXPECT_EQ(*stack.try_pop(), "a");
+    EXPECT_FALSE(stack.try_pop().has_value());
+}
+
+TEST(LockFreeStackTest, PushListAndPopAll) {
+    LockFreeStack<int> stack;
+    stack.push(0);
+
+    std::vector<int> items = {1, 2, 3, 4};
+    stack.push_list(items.begin(), items.end());
+
+    std::vector<int> popped;
+    EXPECT_EQ(stack.pop_all(std::back_inserter(popped)), 5);
+    EXPECT_EQ(popped, (std::vector<int>{4, 3, 2, 1, 0}));
+    EXPECT_TRUE(stack.empty_approx());
+
+    // nodes are recycled
+    stack.push(42);
+    EXPECT_EQ(*stack.try_pop(), 42);
+}
+
+TEST(LockFreeStackTest, ConcurrentFreeList) {
+    constexpr int kThreads = 8;
+    constexpr int kIterations = 50'000;
+    constexpr int kObjects = 16;
+
+    // a pool of object pointers shared by all threads, like an object pool's free list
+    std::vector<std::atomic<int>> owners(kObjects);
+    LockFreeStack<int> free_list(4);
+    for (int i = 0; i < kObjects; ++i) {
+        free_list.push(i);
+    }
+
+    std::atomic<bool> double_owner{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < kIterations; ++i) {
+                auto object = free_list.try_pop();
+                if (!object) {
+                    continue;
+                }
+                if (owners[*object].exchange(t + 1) != 0) {
+                    double_owner.store(true);
+                }
+                owners[*object].store(0);
+                free_list.push(*object);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(double_owner.load());
+
+    std::vector<int> remaining;
+    free_list.pop_all(std::back_inserter(remaining));
+    std::sort(remaining.begin(), remaining.end());
+    ASSERT_EQ(remaining.size(), kObjects);
+    for (int i = 0; i < kObjects; ++i) {
+        EXPECT_EQ(remaining[i], i);
+    }
+}
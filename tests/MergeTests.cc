@@ -0,0 +1,110 @@
+#include "../src/Concurrency/ParallelMerge/ParallelMerge.hpp"
+#include "../src/Containers/LoserTree.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+using Runs = ds::containers::DynamicArray<ds::containers::DynamicArray<int>>;
+
+// k sorted runs of random lengths with many duplicates, plus the expected merge
+static std::vector<int> make_runs(Runs& runs, size_t k, size_t max_length, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<size_t> length(0, max_length);
+    std::uniform_int_distribution<int> value(0, 1000);
+
+    std::vector<int> expected;
+    for (size_t r = 0; r < k; ++r) {
+        std::vector<int> run(length(gen));
+        for (auto& item : run) {
+            item = value(gen);
+        }
+        std::sort(run.begin(), run.end());
+
+        ds::containers::DynamicArray<int> stored;
+        for (int item : run) {
+            stored.push_back(item);
+            expected.push_back(item);
+        }
+        runs.push_back(std::move(stored));
+    }
+    std::sort(expected.begin(), expected.end());
+    return expected;
+}
+
+TEST(LoserTreeTest, MergesAnyNumberOfRuns) {
+    for (size_t k : {0, 1, 2, 3, 7, 64, 100}) {
+        Runs runs;
+        const std::vector<int> expected = make_runs(runs, k, 500, static_cast<unsigned>(k));
+
+        const auto merged = ds::containers::merge_runs(runs);
+        ASSERT_EQ(merged.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(merged[i], expected[i]);
+        }
+    }
+}
+
+TEST(LoserTreeTest, StableAcrossRuns) {
+    using Item = std::pair<int, int>;  // (key, run)
+    auto by_key = [](const Item& a, const Item& b) { return a.first < b.first; };
+
+    ds::containers::DynamicArray<ds::containers::DynamicArray<Item>> runs(3);
+    for (int r = 0; r < 3; ++r) {
+        for (int key = 0; key < 10; key += r + 1) {
+            runs[r].push_back(Item{key, r});
+        }
+    }
+
+    ds::containers::LoserTree<Item, decltype(by_key)> tree(runs, by_key);
+    EXPECT_EQ(tree.top(), Item(0, 0));
+
+    Item previous = tree.top();
+    tree.pop();
+    while (!tree.empty()) {
+        const Item current = tree.top();
+        ASSERT_TRUE(previous.first < current.first || (previous.first == current.first && previous.second < current.second));
+        previous = current;
+        tree.pop();
+    }
+    EXPECT_THROW(tree.top(), std::runtime_error);
+}
+
+TEST(LoserTreeTest, BatchOutput) {
+    Runs runs;
+    const std::vector<int> expected = make_runs(runs, 16, 1000, 42);
+
+    ds::containers::LoserTree<int> tree(runs);
+    std::vector<int> merged(expected.size() + 10);
+    size_t written = 0;
+    while (size_t count = tree.next_batch(merged.data() + written, 37)) {
+        written += count;
+    }
+    ASSERT_EQ(written, expected.size());
+    merged.resize(written);
+    EXPECT_EQ(merged, expected);
+}
+
+TEST(ParallelMergeTest, MatchesSequentialMerge) {
+    ds::runtime::ThreadPool pool(4);
+    pool.start();
+
+    for (size_t k : {1, 5, 64}) {
+        for (size_t parts : {0, 1, 3, 16}) {
+            Runs runs;
+            const std::vector<int> expected = make_runs(runs, k, 2000, static_cast<unsigned>(k * 31 + parts));
+
+            const auto merged = ds::runtime::parallel_merge(pool, runs, parts);
+            ASSERT_EQ(merged.size(), expected.size());
+            for (size_t i = 0; i < expected.size(); ++i) {
+                ASSERT_EQ(merged[i], expected[i]);
+            }
+        }
+    }
+
+    Runs empty(4);
+    EXPECT_TRUE(ds::runtime::parallel_merge(pool, empty, 8).empty());
+
+    pool.stop();
+}
@@ -0,0 +1,88 @@
+#include "../src/Concurrency/MultiQueue/MultiQueue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T, typename Compare = std::less<long>>
+using MultiQueue = ds::runtime::MultiQueue<T, Compare>;
+
+TEST(MultiQueueTest, SingleHeapIsExact) {
+    MultiQueue<std::string> queue(1, 1);
+    EXPECT_EQ(queue.shard_count(), 1);
+    EXPECT_FALSE(queue.try_pop().has_value());
+
+    queue.push(3, "c");
+    queue.push(9, "i");
+    queue.push(1, "a");
+    queue.push(5, "e");
+    EXPECT_EQ(queue.size_approx(), 4);
+
+    std::string order;
+    while (auto node = queue.try_pop()) {
+        order += node->item;
+    }
+    EXPECT_EQ(order, "ieca");
+    EXPECT_TRUE(queue.empty_approx());
+}
+
+TEST(MultiQueueTest, RelaxedOrderStaysCloseToTop) {
+    MultiQueue<int, std::greater<long>> queue(4, 2);
+    const int n = 20000;
+    for (int i = 0; i < n; ++i) {
+        queue.push((i * 7919) % n, i);
+    }
+
+    // every element comes out exactly once, and early pops are near the minimum
+    std::vector<bool> seen(n, false);
+    long rank_error = 0;
+    for (int popped = 0; popped < n; ++popped) {
+        auto node = queue.try_pop();
+        ASSERT_TRUE(node.has_value());
+        ASSERT_FALSE(seen[node->priority]);
+        seen[node->priority] = true;
+        rank_error += node->priority - popped;
+    }
+    EXPECT_FALSE(queue.try_pop().has_value());
+    EXPECT_LT(rank_error / n, 200);
+}
+
+TEST(MultiQueueTest, ConcurrentProducersAndConsumers) {
+    const int threads = 4;
+    const int per_thread = 20000;
+    MultiQueue<int> queue(threads);
+
+    std::atomic<int> produced_done{0};
+    std::atomic<long> sum{0};
+    std::atomic<int> count{0};
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                const int value = t * per_thread + i;
+                queue.push(value % 1000, value);
+            }
+            produced_done.fetch_add(1);
+        });
+        workers.emplace_back([&] {
+            for (;;) {
+                if (auto node = queue.try_pop()) {
+                    sum.fetch_add(node->item);
+                    count.fetch_add(1);
+                } else if (produced_done.load() == threads && queue.empty_approx()) {
+                    break;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    const long total = static_cast<long>(threads) * per_thread;
+    EXPECT_EQ(count.load(), total);
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+}
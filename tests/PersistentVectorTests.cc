@@ -0,0 +1,106 @@
+#include "../src/Containers/PersistentVector.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+template <typename T>
+using PersistentVector = ds::containers::PersistentVector<T>;
+
+TEST(PersistentVectorTest, PushBackKeepsOldVersions) {
+    std::vector<PersistentVector<int>> versions;
+    PersistentVector<int> vec;
+    versions.push_back(vec);
+
+    for (int i = 0; i < 2000; ++i) {
+        vec = vec.push_back(i);
+        versions.push_back(vec);
+    }
+
+    ASSERT_EQ(vec.size(), 2000);
+    for (size_t v = 0; v < versions.size(); v += 97) {
+        ASSERT_EQ(versions[v].size(), v);
+        for (size_t i = 0; i < v; ++i) {
+            ASSERT_EQ(versions[v][i], static_cast<int>(i));
+        }
+    }
+}
+
+TEST(PersistentVectorTest, SetSharesUnchangedNodes) {
+    PersistentVector<int> vec;
+    for (int i = 0; i < 5000; ++i) {
+        vec = vec.push_back(i);
+    }
+
+    auto updated = vec.set(1234, -1).set(4999, -2);
+
+    EXPECT_EQ(vec[1234], 1234);
+    EXPECT_EQ(vec[4999], 4999);
+    EXPECT_EQ(updated[1234], -1);
+    EXPECT_EQ(updated[4999], -2);
+    EXPECT_EQ(updated[1233], 1233);
+    EXPECT_THROW(vec.set(5000, 0), std::out_of_range);
+}
+
+TEST(PersistentVectorTest, PopBackShrinksTree) {
+    PersistentVector<std::string> vec;
+    for (int i = 0; i < 1100; ++i) {
+        vec = vec.push_back(std::to_string(i));
+    }
+
+    auto snapshot = vec;
+    while (!vec.empty()) {
+        ASSERT_EQ(vec.back(), std::to_string(vec.size() - 1));
+        vec = vec.pop_back();
+    }
+
+    EXPECT_EQ(snapshot.size(), 1100);
+    EXPECT_EQ(snapshot[1099], "1099");
+    EXPECT_THROW(vec.pop_back(), std::runtime_error);
+
+    // the shrunk structure must be able to grow again
+    for (int i = 0; i < 100; ++i) {
+        vec = vec.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(vec[99], "99");
+}
+
+TEST(PersistentVectorTest, TransientBatchEdit) {
+    PersistentVector<int> base = {1, 2, 3};
+
+    auto batch = base.transient();
+    for (int i = 0; i < 3000; ++i) {
+        batch.push_back(i);
+    }
+    auto middle = batch.persistent();
+
+    batch.set(0, 100);
+    batch.set(1500, -1);
+    batch.pop_back();
+    auto result = batch.persistent();
+
+    EXPECT_EQ(base.size(), 3);
+    EXPECT_EQ(base[0], 1);
+
+    EXPECT_EQ(middle.size(), 3003);
+    EXPECT_EQ(middle[0], 1);
+    EXPECT_EQ(middle[1500], 1497);
+    EXPECT_EQ(middle.back(), 2999);
+
+    EXPECT_EQ(result.size(), 3002);
+    EXPECT_EQ(result[0], 100);
+    EXPECT_EQ(result[1500], -1);
+    EXPECT_EQ(result.back(), 2998);
+}
+
+TEST(PersistentVectorTest, Iteration) {
+    PersistentVector<int> vec;
+    for (int i = 0; i < 100; ++i) {
+        vec = vec.push_back(i);
+    }
+
+    int expected = 0;
+    for (int value : vec) {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 100);
+}
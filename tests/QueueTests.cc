@@ -0,0 +1,167 @@
+#include "../src/Containers/Queue.hpp"
+#include <deque>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+template <typename T>
+using Queue = ds::containers::Queue<T>;
+
+TEST(QueueTest, FifoOrder) {
+    Queue<int> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_THROW(queue.front(), std::runtime_error);
+    EXPECT_THROW(queue.dequeue(), std::runtime_error);
+
+    for (int i = 0; i < 100; ++i) {
+        queue.enqueue(i);
+    }
+    EXPECT_EQ(queue.size(), 100);
+    EXPECT_EQ(queue.capacity(), 128);
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(queue.front(), i);
+        queue.dequeue();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(QueueTest, GrowthUnrollsWrappedRing) {
+    Queue<std::string> queue;
+    for (int i = 0; i < 6; ++i) {
+        queue.enqueue(std::to_string(i));
+    }
+    for (int i = 0; i < 4; ++i) {
+        queue.dequeue();
+    }
+    // head is in the middle of the buffer, the next pushes wrap around and then force growth
+    for (int i = 6; i < 20; ++i) {
+        queue.enqueue(std::to_string(i));
+    }
+
+    ASSERT_EQ(queue.size(), 16);
+    for (size_t i = 0; i < queue.size(); ++i) {
+        EXPECT_EQ(queue[i], std::to_string(i + 4));
+    }
+}
+
+TEST(QueueTest, DoubleEndedMatchesStdDeque) {
+    std::mt19937 gen(3);
+    Queue<int> queue;
+    std::deque<int> reference;
+
+    for (int step = 0; step < 10000; ++step) {
+        switch (gen() % 4) {
+            case 0:
+                queue.push_back(step);
+                reference.push_back(step);
+                break;
+            case 1:
+                queue.push_front(step);
+                reference.push_front(step);
+                break;
+            case 2:
+                if (!reference.empty()) {
+                    ASSERT_EQ(queue.back(), reference.back());
+                    queue.pop_back();
+                    reference.pop_back();
+                }
+                break;
+            default:
+                if (!reference.empty()) {
+                    ASSERT_EQ(queue.front(), reference.front());
+                    queue.pop_front();
+                    reference.pop_front();
+                }
+                break;
+        }
+        ASSERT_EQ(queue.size(), reference.size());
+    }
+
+    for (size_t i = 0; i < reference.size(); ++i) {
+        ASSERT_EQ(queue.at(i), reference[i]);
+    }
+}
+
+TEST(QueueTest, CopyMoveAndReverse) {
+    Queue<std::string> queue;
+    queue.push_front("b");
+    queue.push_front("a");
+    queue.push_back("c");
+
+    Queue<std::string> copy(queue);
+    Queue<std::string> reversed = queue.reverse();
+    Queue<std::string> moved(std::move(queue));
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(moved.front(), "a");
+    EXPECT_EQ(copy.back(), "c");
+    EXPECT_EQ(reversed.front(), "c");
+    EXPECT_EQ(reversed.back(), "a");
+
+    copy.swap(reversed);
+    EXPECT_EQ(copy.front(), "c");
+    EXPECT_EQ(reversed.front(), "a");
+}
+
+TEST(QueueTest, EmplaceFromOwnElementWhileGrowing) {
+    // long enough to live on the heap, a dangling argument would be a use after free
+    const std::string padding(32, 'x');
+    Queue<std::string> queue;
+    for (int i = 0; i < 8; ++i) {
+        queue.push_back(padding + std::to_string(i));
+    }
+    ASSERT_EQ(queue.size(), queue.capacity());
+
+    queue.emplace_back(queue.front());
+    EXPECT_EQ(queue.back(), padding + "0");
+
+    while (queue.size() < queue.capacity()) {
+        queue.push_back(padding);
+    }
+    queue.emplace_front(queue.back());
+    EXPECT_EQ(queue.front(), padding);
+    EXPECT_EQ(queue[1], padding + "0");
+    EXPECT_EQ(queue.size(), 17);
+}
+
+// Copies throw once the budget runs out, moves may throw so growth has to copy
+struct ThrowingCopy {
+    static inline int copies_left = 0;
+    std::string value;
+
+    explicit ThrowingCopy(std::string v) : value(std::move(v)) {}
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+        if (--copies_left < 0) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    ThrowingCopy(ThrowingCopy&& other) noexcept(false) : value(std::move(other.value)) {}
+    ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+
+TEST(QueueTest, ThrowingGrowthLeavesQueueUnchanged) {
+    const std::string padding(32, 'x');
+    Queue<ThrowingCopy> queue;
+    for (int i = 0; i < 8; ++i) {
+        queue.emplace_back(padding + std::to_string(i));
+    }
+    queue.pop_front();
+    queue.emplace_back(padding + "8");  // wrapped and full
+
+    ThrowingCopy::copies_left = 3;
+    EXPECT_THROW(queue.emplace_back(padding + "9"), std::runtime_error);
+    EXPECT_THROW(queue.reserve(64), std::runtime_error);
+
+    ASSERT_EQ(queue.size(), 8);
+    EXPECT_EQ(queue.capacity(), 8);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(queue[i].value, padding + std::to_string(i + 1));
+    }
+
+    ThrowingCopy::copies_left = 100;
+    queue.emplace_back(padding + "9");
+    EXPECT_EQ(queue.size(), 9);
+    EXPECT_EQ(queue.back().value, padding + "9");
+    EXPECT_EQ(queue.front().value, padding + "1");
+}
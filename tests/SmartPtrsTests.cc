@@ -1,8 +1,15 @@
+#include "../src/SmartPtrs/AtomicSharedPtr.hpp"
 #include "../src/SmartPtrs/ControlBlock.hpp"
+#include "../src/SmartPtrs/IntrusivePtr.hpp"
 #include "../src/SmartPtrs/SharedPtr.hpp"
 #include "../src/SmartPtrs/UniquePtr.hpp"
 #include "../src/SmartPtrs/WeakPtr.hpp"
+#include <atomic>
+#include <cstring>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 
 template <typename T>
@@ -290,3 +297,466 @@ TEST_F(SmartPtrTest, HandlesCyclicDependency) {
     b.reset();
     EXPECT_EQ(DestructionTracker::instances_destroyed, 2);
 }
+
+
+// Records every allocation so tests can check that allocate_shared makes exactly one
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    int* allocations;
+    int* deallocations;
+
+    CountingAllocator(int* allocs, int* deallocs) noexcept : allocations(allocs), deallocations(deallocs) {}
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept : allocations(other.allocations), deallocations(other.deallocations) {}
+
+    T* allocate(size_t n) {
+        ++*allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        ++*deallocations;
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>& other) const noexcept {
+        return allocations == other.allocations;
+    }
+};
+
+struct ThrowingConstructor {
+    explicit ThrowingConstructor(int value) {
+        if (value < 0) {
+            throw std::invalid_argument("negative");
+        }
+    }
+};
+
+TEST_F(SmartPtrTest, SharedPtr_AllocateShared) {
+    int allocations = 0;
+    int deallocations = 0;
+    CountingAllocator<DestructionTracker> alloc(&allocations, &deallocations);
+    {
+        SharedPtr<DestructionTracker> sp = ds::smart_ptrs::allocate_shared<DestructionTracker>(alloc);
+        WeakPtr<DestructionTracker> wp(sp);
+        EXPECT_EQ(allocations, 1);  // object and control block together
+
+        sp.reset();
+        EXPECT_EQ(DestructionTracker::instances_destroyed, 1);
+        EXPECT_EQ(deallocations, 0);  // the weak reference keeps the block
+    }
+    EXPECT_EQ(deallocations, 1);
+
+    CountingAllocator<ThrowingConstructor> throwing(&allocations, &deallocations);
+    EXPECT_THROW(ds::smart_ptrs::allocate_shared<ThrowingConstructor>(throwing, -1), std::invalid_argument);
+    EXPECT_EQ(allocations, 2);
+    EXPECT_EQ(deallocations, 2);
+}
+
+TEST_F(SmartPtrTest, SharedPtr_PooledBlocksAreReused) {
+    using Pool = ds::smart_ptrs::ControlBlockPool;
+
+    void* first = nullptr;
+    {
+        SharedPtr<int> sp = make_shared<int>(1);
+        first = sp.get();
+    }
+    const size_t bytes = sizeof(ds::smart_ptrs::AllocateSharedControlBlock<int, ds::smart_ptrs::ControlBlockAllocator<int>>);
+    EXPECT_GE(Pool::cached(bytes), 1);
+
+    SharedPtr<int> sp = make_shared<int>(2);
+    EXPECT_EQ(static_cast<void*>(sp.get()), first);  // served from this thread's cache
+    EXPECT_EQ(*sp, 2);
+}
+
+// Allocates from the pool in a thread_local destructor that runs after the thread's cache is gone
+struct LateAllocation {
+    static inline void* block = nullptr;
+
+    ~LateAllocation() {
+        block = ds::smart_ptrs::ControlBlockPool::allocate(24);
+    }
+};
+
+TEST_F(SmartPtrTest, SharedPtr_PoolBypassKeepsTheClassSize) {
+    using Pool = ds::smart_ptrs::ControlBlockPool;
+
+    std::thread worker([] {
+        thread_local LateAllocation late;  // constructed first, so destroyed after the cache
+        (void)&late;
+        Pool::deallocate(Pool::allocate(24), 24);
+    });
+    worker.join();
+    ASSERT_NE(LateAllocation::block, nullptr);
+
+    // freed into this thread's live cache and handed out for the whole 32-byte class
+    Pool::deallocate(LateAllocation::block, 24);
+    void* reused = Pool::allocate(32);
+    EXPECT_EQ(reused, LateAllocation::block);
+    std::memset(reused, 0xab, 32);
+    Pool::deallocate(reused, 32);
+}
+
+TEST_F(SmartPtrTest, SharedPtr_CompactControlBlock) {
+    // a manager function pointer and one word with both counts, no vtable
+    EXPECT_EQ(sizeof(ds::smart_ptrs::BaseControlBlock<>), 2 * sizeof(void*));
+    EXPECT_EQ(sizeof(ds::smart_ptrs::DefaultControlBlock<DestructionTracker>), 3 * sizeof(void*));
+
+    WeakPtr<DestructionTracker> weak;
+    {
+        SharedPtr<DestructionTracker> sole(new DestructionTracker());
+        SharedPtr<DestructionTracker> fused = make_shared<DestructionTracker>();
+        weak = fused;
+    }
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 2);
+    EXPECT_TRUE(weak.expired());  // the block outlives the object while weak references remain
+}
+
+TEST_F(SmartPtrTest, SharedPtr_ReleasedOnAnotherThread) {
+    constexpr int COUNT = 10000;
+
+    std::vector<SharedPtr<DestructionTracker>> pointers;
+    for (int i = 0; i < COUNT; ++i) {
+        pointers.push_back(i % 2 == 0 ? make_shared<DestructionTracker>() : SharedPtr<DestructionTracker>(new DestructionTracker()));
+    }
+
+    std::thread consumer([moved = std::move(pointers)]() mutable { moved.clear(); });
+    consumer.join();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, COUNT);
+}
+
+
+struct Shape : ds::smart_ptrs::RefCounted<Shape> {
+    virtual ~Shape() {
+        DestructionTracker::instances_destroyed++;
+    }
+
+    virtual int sides() const = 0;
+};
+
+struct Square : Shape {
+    int sides() const override {
+        return 4;
+    }
+};
+
+struct LocalNode : ds::smart_ptrs::RefCounted<LocalNode, ds::smart_ptrs::PlainCounter> {
+    int value;
+    ds::smart_ptrs::IntrusivePtr<LocalNode> next;
+
+    explicit LocalNode(int v) : value(v) {}
+
+    ~LocalNode() {
+        DestructionTracker::instances_destroyed++;
+    }
+};
+
+TEST_F(SmartPtrTest, IntrusivePtr_SharesTheObjectsCount) {
+    using ds::smart_ptrs::IntrusivePtr;
+    static_assert(sizeof(IntrusivePtr<Shape>) == sizeof(void*));
+
+    IntrusivePtr<Square> square = ds::smart_ptrs::make_intrusive<Square>();
+    EXPECT_EQ(square.use_count(), 1);
+
+    IntrusivePtr<Shape> shape = square;  // upcast shares the same count
+    EXPECT_EQ(square.use_count(), 2);
+    EXPECT_EQ(shape->sides(), 4);
+
+    // a raw pointer to a live object can be turned back into an owner
+    IntrusivePtr<Shape> again(shape.get());
+    EXPECT_EQ(again.use_count(), 3);
+    EXPECT_TRUE(again == square);
+
+    Square copy(*square);  // copying the object doesn't copy its references
+    EXPECT_EQ(copy.use_count(), 0);
+
+    square.reset();
+    shape = nullptr;
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 0);
+    EXPECT_TRUE(again.unique());
+
+    Shape* raw = again.detach();
+    EXPECT_EQ(again, nullptr);
+    IntrusivePtr<Shape> adopted(raw, false);
+    EXPECT_EQ(adopted.use_count(), 1);
+
+    adopted.reset();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 1);
+    EXPECT_THROW(*adopted, std::runtime_error);
+}
+
+TEST_F(SmartPtrTest, IntrusivePtr_PlainCounterList) {
+    using ds::smart_ptrs::IntrusivePtr;
+
+    IntrusivePtr<LocalNode> head;
+    for (int i = 0; i < 100; ++i) {
+        auto node = ds::smart_ptrs::make_intrusive<LocalNode>(i);
+        node->next = std::move(head);
+        head = std::move(node);
+    }
+
+    IntrusivePtr<LocalNode> middle = head;
+    for (int i = 0; i < 50; ++i) {
+        middle = middle->next;
+    }
+    EXPECT_EQ(middle->value, 49);
+    EXPECT_EQ(middle.use_count(), 2);
+
+    head.reset();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 50);
+    middle.reset();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 100);
+}
+
+TEST_F(SmartPtrTest, IntrusivePtr_AtomicCountAcrossThreads) {
+    using ds::smart_ptrs::IntrusivePtr;
+
+    IntrusivePtr<Shape> shape = ds::smart_ptrs::make_intrusive<Square>();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([shape] {
+            for (int i = 0; i < 10000; ++i) {
+                IntrusivePtr<Shape> copy = shape;
+                EXPECT_EQ(copy->sides(), 4);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(shape.use_count(), 1);
+    shape.reset();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 1);
+}
+
+TEST_F(SmartPtrTest, LocalSharedPtr_PlainCounts) {
+    using ds::smart_ptrs::LocalSharedPtr;
+    using ds::smart_ptrs::LocalWeakPtr;
+
+    LocalWeakPtr<DestructionTracker> weak;
+    {
+        LocalSharedPtr<DestructionTracker> first = ds::smart_ptrs::make_local_shared<DestructionTracker>();
+        LocalSharedPtr<DestructionTracker> second = first;
+        weak = second;
+        EXPECT_EQ(first.use_count(), 2);
+
+        LocalSharedPtr<DestructionTracker> locked = weak.lock();
+        EXPECT_EQ(locked.get(), first.get());
+        EXPECT_EQ(first.use_count(), 3);
+
+        LocalSharedPtr<DestructionTracker> raw(new DestructionTracker());
+        EXPECT_TRUE(raw.unique());
+    }
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 2);
+    EXPECT_TRUE(weak.expired());
+    EXPECT_EQ(weak.lock(), nullptr);
+}
+
+#ifndef NDEBUG
+TEST_F(SmartPtrTest, LocalSharedPtr_AssertsSingleThreadUse) {
+    ds::smart_ptrs::LocalSharedPtr<int> shared = ds::smart_ptrs::make_shared<int, ds::smart_ptrs::PlainCounter>(7);
+    EXPECT_DEATH(
+        {
+            std::thread other([&shared] { ds::smart_ptrs::LocalSharedPtr<int> copy = shared; });
+            other.join();
+        },
+        "more than one thread");
+}
+#endif
+
+TEST_F(SmartPtrTest, AtomicSharedPtr_LoadStoreExchange) {
+    ds::smart_ptrs::AtomicSharedPtr<DestructionTracker> slot;
+    EXPECT_TRUE(slot.is_lock_free());
+    EXPECT_EQ(slot.load(), nullptr);
+
+    SharedPtr<DestructionTracker> first = make_shared<DestructionTracker>();
+    slot.store(first);
+    const size_t stored_count = first.use_count();  // includes the slot's reserve
+    EXPECT_GT(stored_count, 2);
+
+    {
+        SharedPtr<DestructionTracker> loaded = slot.load();
+        EXPECT_EQ(loaded.get(), first.get());
+        EXPECT_EQ(first.use_count(), stored_count);  // the load claimed a reserved reference
+    }
+
+    SharedPtr<DestructionTracker> second(new DestructionTracker());
+    SharedPtr<DestructionTracker> expected = second;
+    EXPECT_FALSE(slot.compare_exchange_strong(expected, SharedPtr<DestructionTracker>()));
+    EXPECT_EQ(expected.get(), first.get());
+
+    EXPECT_TRUE(slot.compare_exchange_strong(expected, second));
+    EXPECT_EQ(slot.load().get(), second.get());
+    expected.reset();
+    EXPECT_TRUE(first.unique());
+
+    first.reset();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 1);
+
+    SharedPtr<DestructionTracker> previous = slot.exchange(SharedPtr<DestructionTracker>());
+    EXPECT_EQ(previous.get(), second.get());
+    EXPECT_EQ(second.use_count(), 2);  // the reserve left with the slot
+    EXPECT_EQ(slot.load(), nullptr);
+}
+
+TEST_F(SmartPtrTest, AtomicSharedPtr_ManyLoadsRefillTheReserve) {
+    SharedPtr<int> value = make_shared<int>(5);
+    {
+        ds::smart_ptrs::AtomicSharedPtr<int> slot(value);
+        std::vector<SharedPtr<int>> kept;
+        for (int i = 0; i < 200000; ++i) {
+            SharedPtr<int> loaded = slot.load();
+            ASSERT_EQ(*loaded, 5);
+            if (i % 1000 == 0) {
+                kept.push_back(loaded);
+            }
+        }
+    }
+    EXPECT_TRUE(value.unique());  // every reserved reference was given back
+}
+
+struct Config {
+    explicit Config(int v) : version(v), checksum(v * 7) {}
+
+    ~Config() {
+        destroyed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int version;
+    int checksum;
+
+    static std::atomic<int> destroyed;
+};
+
+std::atomic<int> Config::destroyed{0};
+
+TEST_F(SmartPtrTest, AtomicSharedPtr_ConcurrentReadersAndWriter) {
+    constexpr int VERSIONS = 2000;
+    Config::destroyed = 0;
+    {
+        ds::smart_ptrs::AtomicSharedPtr<Config> config(make_shared<Config>(0));
+        std::atomic<bool> done{false};
+
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&] {
+                int last = 0;
+                while (!done.load(std::memory_order_relaxed)) {
+                    SharedPtr<Config> snapshot = config.load();
+                    ASSERT_EQ(snapshot->checksum, snapshot->version * 7);
+                    ASSERT_GE(snapshot->version, last);  // a single writer publishes in order
+                    last = snapshot->version;
+                }
+            });
+        }
+
+        for (int v = 1; v <= VERSIONS; ++v) {
+            if (v % 2 == 0) {
+                config.store(make_shared<Config>(v));
+            } else {
+                SharedPtr<Config> expected = config.load();
+                while (!config.compare_exchange_weak(expected, make_shared<Config>(v))) {
+                }
+            }
+        }
+        done = true;
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        EXPECT_EQ(config.load()->version, VERSIONS);
+        EXPECT_EQ(Config::destroyed.load(), VERSIONS);
+    }
+    EXPECT_EQ(Config::destroyed.load(), VERSIONS + 1);
+}
+
+TEST_F(SmartPtrTest, BiasedSharedPtr_OwnerCopiesAndWeakLock) {
+    using ds::smart_ptrs::BiasedSharedPtr;
+    using ds::smart_ptrs::BiasedWeakPtr;
+
+    BiasedWeakPtr<DestructionTracker> weak;
+    {
+        BiasedSharedPtr<DestructionTracker> first = ds::smart_ptrs::make_biased_shared<DestructionTracker>();
+        BiasedSharedPtr<DestructionTracker> second = first;
+        weak = second;
+        EXPECT_EQ(first.use_count(), 2);
+
+        BiasedSharedPtr<DestructionTracker> locked = weak.lock();
+        EXPECT_EQ(locked.get(), first.get());
+        EXPECT_EQ(first.use_count(), 3);
+    }
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 1);
+    EXPECT_TRUE(weak.expired());
+    EXPECT_EQ(weak.lock(), nullptr);
+}
+
+TEST_F(SmartPtrTest, BiasedSharedPtr_CopiesReleasedOnOtherThreads) {
+    using ds::smart_ptrs::BiasedSharedPtr;
+
+    BiasedSharedPtr<DestructionTracker> owner = ds::smart_ptrs::make_biased_shared<DestructionTracker>();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        // the copies are counted by the owner, then dropped elsewhere
+        threads.emplace_back([copy = owner]() mutable {
+            for (int i = 0; i < 1000; ++i) {
+                BiasedSharedPtr<DestructionTracker> local = copy;
+            }
+            copy.reset();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 0);
+    EXPECT_EQ(owner.use_count(), 1);
+
+    owner.reset();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 1);
+}
+
+TEST_F(SmartPtrTest, BiasedSharedPtr_OwnerHandsOffItsLastReference) {
+    using ds::smart_ptrs::BiasedSharedPtr;
+
+    BiasedSharedPtr<DestructionTracker> owner = ds::smart_ptrs::make_biased_shared<DestructionTracker>();
+    std::thread other([moved = std::move(owner)]() mutable { moved.reset(); });
+    other.join();
+
+    // the count went negative on the other thread: the object waits for its owner to merge
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 0);
+    ds::smart_ptrs::BiasedOwner::collect();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 1);
+
+    // creating a biased pointer merges the queue as well
+    owner = ds::smart_ptrs::make_biased_shared<DestructionTracker>();
+    std::thread again([moved = std::move(owner)]() mutable { moved.reset(); });
+    again.join();
+    BiasedSharedPtr<int> next = ds::smart_ptrs::make_biased_shared<int>(1);
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 2);
+}
+
+TEST_F(SmartPtrTest, BiasedSharedPtr_OwnerThreadExits) {
+    using ds::smart_ptrs::BiasedSharedPtr;
+    using ds::smart_ptrs::BiasedWeakPtr;
+
+    BiasedSharedPtr<DestructionTracker> kept;
+    BiasedWeakPtr<DestructionTracker> weak;
+    std::thread creator([&] {
+        kept = ds::smart_ptrs::make_biased_shared<DestructionTracker>();
+        BiasedSharedPtr<DestructionTracker> copy = kept;
+        weak = copy;
+    });
+    creator.join();
+
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 0);
+    BiasedSharedPtr<DestructionTracker> locked = weak.lock();
+    EXPECT_EQ(locked.get(), kept.get());
+    kept.reset();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 0);
+    locked.reset();
+    EXPECT_EQ(DestructionTracker::instances_destroyed, 1);
+    EXPECT_TRUE(weak.expired());
+}
@@ -0,0 +1,190 @@
+#include "../src/Concurrency/ThreadPool/ThreadPool.hpp"
+#include "../src/Concurrency/Timer/TimerService.hpp"
+#include "../src/Concurrency/Timer/TimingWheel.hpp"
+#include "../src/Concurrency/WaitGroup/WaitGroup.hpp"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+template <typename T>
+using TimingWheel = ds::runtime::TimingWheel<T>;
+
+using TimerId = ds::runtime::TimerId;
+
+TEST(TimingWheelTest, FiresInDeadlineOrder) {
+    TimingWheel<std::string> wheel;
+    wheel.schedule(5, "five");
+    wheel.schedule(1, "one");
+    wheel.schedule(300, "three hundred");
+    wheel.schedule(70, "seventy");
+    wheel.schedule(0, "next tick");
+    EXPECT_EQ(wheel.size(), 5);
+
+    std::vector<std::string> fired;
+    auto collect = [&](std::string&& name) {
+        fired.push_back(std::move(name) + "@" + std::to_string(wheel.now()));
+    };
+
+    EXPECT_EQ(wheel.advance(4, collect), 2);
+    EXPECT_EQ(wheel.advance_to(1000, collect), 3);
+    EXPECT_EQ(fired, (std::vector<std::string>{"one@1", "next tick@1", "five@5", "seventy@70", "three hundred@300"}));
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(wheel.now(), 1000);
+}
+
+TEST(TimingWheelTest, CancelIsO1AndHandlesStaleIds) {
+    TimingWheel<int> wheel;
+    TimerId a = wheel.schedule(10, 1);
+    TimerId b = wheel.schedule(10, 2);
+    TimerId c = wheel.schedule(5000, 3);
+
+    EXPECT_TRUE(wheel.cancel(b));
+    EXPECT_FALSE(wheel.cancel(b));
+    EXPECT_TRUE(wheel.cancel(c));
+    EXPECT_EQ(wheel.size(), 1);
+
+    // the freed node is reused, the old id must not cancel the new timer
+    TimerId d = wheel.schedule(20, 4);
+    EXPECT_FALSE(wheel.is_armed(b));
+    EXPECT_TRUE(wheel.is_armed(d));
+
+    std::vector<int> fired;
+    wheel.advance(10'000, [&](int value) {
+        fired.push_back(value);
+    });
+    EXPECT_EQ(fired, (std::vector<int>{1, 4}));
+    EXPECT_FALSE(wheel.is_armed(a));
+}
+
+TEST(TimingWheelTest, CallbacksCanRescheduleAndCancel) {
+    TimingWheel<int> wheel;
+    TimerId victim = wheel.schedule(3, -1);
+    wheel.schedule(2, 0);
+
+    std::vector<uint64_t> ticks;
+    wheel.advance(100, [&](int value) {
+        ticks.push_back(wheel.now());
+        if (value == 0) {
+            wheel.cancel(victim);
+        }
+        if (value < 3) {
+            wheel.schedule(10, value + 1);  // periodic timer
+        }
+    });
+    EXPECT_EQ(ticks, (std::vector<uint64_t>{2, 12, 22, 32}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimingWheelTest, MatchesReferenceAcrossAllLevels) {
+    struct Armed {
+        TimerId id;
+        uint64_t deadline;
+    };
+
+    std::mt19937_64 gen(11);
+    TimingWheel<uint64_t> wheel(123456);
+    std::map<uint64_t, Armed> armed;  // payload => timer
+    uint64_t next_payload = 0;
+    size_t fired = 0;
+
+    for (int round = 0; round < 300; ++round) {
+        for (int i = 0; i < 50; ++i) {
+            // delays from one tick up to past the 64^6 ticks covered by the wheels (overflow list)
+            const int bits = static_cast<int>(gen() % 40);
+            const uint64_t delay = 1 + (gen() & ((uint64_t{1} << bits) - 1));
+            armed[next_payload] = Armed{wheel.schedule(delay, next_payload), wheel.now() + delay};
+            ++next_payload;
+        }
+        for (int i = 0; i < 10; ++i) {
+            auto it = armed.lower_bound(gen() % next_payload);
+            if (it != armed.end()) {
+                ASSERT_TRUE(wheel.cancel(it->second.id));
+                armed.erase(it);
+            }
+        }
+
+        const uint64_t target = wheel.now() + gen() % (uint64_t{1} << (round % 40));
+        wheel.advance_to(target, [&](uint64_t payload) {
+            auto it = armed.find(payload);
+            ASSERT_NE(it, armed.end());
+            ASSERT_EQ(it->second.deadline, wheel.now());
+            armed.erase(it);
+            ++fired;
+        });
+
+        ASSERT_EQ(wheel.size(), armed.size());
+        for (const auto& [payload, timer] : armed) {
+            ASSERT_GT(timer.deadline, target);
+        }
+        if (auto next = wheel.next_expiry()) {
+            uint64_t earliest = UINT64_MAX;
+            for (const auto& [payload, timer] : armed) {
+                earliest = std::min(earliest, timer.deadline);
+            }
+            ASSERT_LE(*next, earliest);
+        }
+    }
+    EXPECT_GT(fired, 1000);
+}
+
+TEST(TimerServiceTest, RunsCallbacksAfterTheirDelay) {
+    ds::runtime::TimerService timers;
+    ds::sync::WaitGroup wg;
+    std::mutex mutex;
+    std::vector<int> order;
+
+    const auto start = std::chrono::steady_clock::now();
+    wg.add(3);
+    for (int delay : {30, 10, 20}) {
+        timers.schedule(std::chrono::milliseconds(delay), [&, delay] {
+            EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(delay));
+            std::lock_guard guard(mutex);
+            order.push_back(delay);
+            wg.done();
+        });
+    }
+    TimerId cancelled = timers.schedule(15ms, [] {
+        ADD_FAILURE() << "cancelled timer fired";
+    });
+    EXPECT_TRUE(timers.cancel(cancelled));
+
+    wg.wait();
+    EXPECT_EQ(order, (std::vector<int>{10, 20, 30}));
+    EXPECT_EQ(timers.pending(), 0);
+}
+
+TEST(TimerServiceTest, ThreadPoolSubmitAfter) {
+    ds::runtime::ThreadPool pool(2);
+    pool.start();
+
+    ds::sync::WaitGroup wg;
+    std::atomic<int> ran{0};
+    wg.add(100);
+    for (int i = 0; i < 100; ++i) {
+        pool.submit_after(std::chrono::milliseconds(i % 10), [&] {
+            EXPECT_EQ(ds::runtime::ThreadPool::current(), &pool);
+            ran.fetch_add(1);
+            wg.done();
+        });
+    }
+    TimerId cancelled = pool.submit_after(1h, [] {});
+    EXPECT_TRUE(pool.cancel(cancelled));
+
+    wg.wait();
+    EXPECT_EQ(ran.load(), 100);
+
+    // still pending at stop() => submitted right away
+    std::atomic<bool> flushed{false};
+    pool.submit_after(1h, [&] {
+        EXPECT_EQ(ds::runtime::ThreadPool::current(), &pool);
+        flushed.store(true);
+    });
+    pool.stop();
+    EXPECT_TRUE(flushed.load());
+}